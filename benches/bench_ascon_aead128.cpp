@@ -52,3 +52,198 @@ BENCHMARK(ascon_aead128_encrypt)
   })
   ->ComputeStatistics("min", compute_min)
   ->ComputeStatistics("max", compute_max);
+
+static void
+ascon_aead128_seal(benchmark::State& state)
+{
+  const size_t associated_data_len = static_cast<size_t>(state.range(0));
+  const size_t plain_text_len = static_cast<size_t>(state.range(1));
+
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  std::vector<uint8_t> associated_data(associated_data_len);
+  std::vector<uint8_t> buffer(plain_text_len + ascon_aead128::TAG_BYTE_LEN); // In-place, plaintext followed by tag
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce);
+  generate_random_data<uint8_t>(associated_data);
+  generate_random_data<uint8_t>(buffer);
+
+  const ascon_aead128::ascon_aead128_key_t key_ctx(key);
+  auto buffer_span = std::span(buffer);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(key_ctx);
+    benchmark::DoNotOptimize(nonce);
+    benchmark::DoNotOptimize(associated_data);
+    benchmark::DoNotOptimize(buffer);
+
+    assert(ascon_aead128::seal(key_ctx, nonce, associated_data, buffer_span.first(plain_text_len), buffer_span) ==
+           ascon_aead128::ascon_aead128_status_t::sealed);
+
+    benchmark::ClobberMemory();
+  }
+
+  const size_t total_bytes_processed = (associated_data_len + plain_text_len) * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+BENCHMARK(ascon_aead128_seal)
+  ->ArgsProduct({
+    { 32 },                             // Associated data
+    { 32, 256, 2 * 1'024, 16 * 1'024 }, // Plain text
+  })
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+static void
+ascon_aead128_decrypt(benchmark::State& state)
+{
+  const size_t associated_data_len = static_cast<size_t>(state.range(0));
+  const size_t cipher_text_len = static_cast<size_t>(state.range(1));
+
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN> tag{};
+  std::vector<uint8_t> associated_data(associated_data_len);
+  std::vector<uint8_t> plaintext(cipher_text_len);
+  std::vector<uint8_t> ciphertext(cipher_text_len);
+  std::vector<uint8_t> decipheredtext(cipher_text_len);
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce);
+  generate_random_data<uint8_t>(associated_data);
+  generate_random_data<uint8_t>(plaintext);
+
+  {
+    ascon_aead128::ascon_aead128_t enc_handle(key, nonce);
+    assert(enc_handle.absorb_data(associated_data) == ascon_aead128::ascon_aead128_status_t::absorbed_data);
+    assert(enc_handle.finalize_data() == ascon_aead128::ascon_aead128_status_t::finalized_data_absorption_phase);
+    assert(enc_handle.encrypt_plaintext(plaintext, ciphertext) == ascon_aead128::ascon_aead128_status_t::encrypted_plaintext);
+    assert(enc_handle.finalize_encrypt(tag) == ascon_aead128::ascon_aead128_status_t::finalized_encryption_phase);
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(key);
+    benchmark::DoNotOptimize(nonce);
+    benchmark::DoNotOptimize(associated_data);
+    benchmark::DoNotOptimize(ciphertext);
+    benchmark::DoNotOptimize(decipheredtext);
+    benchmark::DoNotOptimize(tag);
+
+    ascon_aead128::ascon_aead128_t dec_handle(key, nonce);
+    assert(dec_handle.absorb_data(associated_data) == ascon_aead128::ascon_aead128_status_t::absorbed_data);
+    assert(dec_handle.finalize_data() == ascon_aead128::ascon_aead128_status_t::finalized_data_absorption_phase);
+    assert(dec_handle.decrypt_ciphertext(ciphertext, decipheredtext) == ascon_aead128::ascon_aead128_status_t::decrypted_ciphertext);
+    assert(dec_handle.finalize_decrypt(tag) == ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+
+    benchmark::ClobberMemory();
+  }
+
+  assert(std::ranges::equal(plaintext, decipheredtext));
+
+  const size_t total_bytes_processed = (associated_data_len + cipher_text_len) * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+BENCHMARK(ascon_aead128_decrypt)
+  ->ArgsProduct({
+    { 32 },                             // Associated data
+    { 32, 256, 2 * 1'024, 16 * 1'024 }, // Cipher text
+  })
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+// Encrypts a burst of `num_packets` -many packets, either using the burst API or one-by-one using `ascon_aead128_t`, for comparison.
+template<const bool use_burst_api>
+static void
+ascon_aead128_encrypt_burst(benchmark::State& state)
+{
+  const size_t associated_data_len = static_cast<size_t>(state.range(0));
+  const size_t plain_text_len = static_cast<size_t>(state.range(1));
+  const size_t num_packets = static_cast<size_t>(state.range(2));
+
+  std::vector<std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN>> keys(num_packets);
+  std::vector<std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN>> nonces(num_packets);
+  std::vector<std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN>> tags(num_packets);
+  std::vector<uint8_t> associated_data(associated_data_len * num_packets);
+  std::vector<uint8_t> plaintext(plain_text_len * num_packets);
+  std::vector<uint8_t> ciphertext(plain_text_len * num_packets);
+
+  std::vector<ascon_aead128::ascon_aead128_encrypt_packet_t> packets;
+
+  for (size_t i = 0; i < num_packets; i++) {
+    generate_random_data<uint8_t>(keys[i]);
+    generate_random_data<uint8_t>(nonces[i]);
+
+    packets.push_back({ keys[i],
+                        nonces[i],
+                        std::span(associated_data).subspan(i * associated_data_len, associated_data_len),
+                        std::span(plaintext).subspan(i * plain_text_len, plain_text_len),
+                        std::span(ciphertext).subspan(i * plain_text_len, plain_text_len),
+                        tags[i] });
+  }
+
+  generate_random_data<uint8_t>(associated_data);
+  generate_random_data<uint8_t>(plaintext);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(keys);
+    benchmark::DoNotOptimize(nonces);
+    benchmark::DoNotOptimize(associated_data);
+    benchmark::DoNotOptimize(plaintext);
+    benchmark::DoNotOptimize(ciphertext);
+    benchmark::DoNotOptimize(tags);
+
+    if constexpr (use_burst_api) {
+      [[maybe_unused]] const auto status = ascon_aead128::encrypt_burst(packets);
+      assert(status == ascon_aead128::ascon_aead128_status_t::encrypted_burst);
+    } else {
+      for (const auto& packet : packets) {
+        ascon_aead128::ascon_aead128_t enc_handle(packet.key, packet.nonce);
+        assert(enc_handle.absorb_data(packet.associated_data) == ascon_aead128::ascon_aead128_status_t::absorbed_data);
+        assert(enc_handle.finalize_data() == ascon_aead128::ascon_aead128_status_t::finalized_data_absorption_phase);
+        assert(enc_handle.encrypt_plaintext(packet.plaintext, packet.ciphertext) == ascon_aead128::ascon_aead128_status_t::encrypted_plaintext);
+        assert(enc_handle.finalize_encrypt(packet.tag) == ascon_aead128::ascon_aead128_status_t::finalized_encryption_phase);
+      }
+    }
+
+    benchmark::ClobberMemory();
+  }
+
+  const size_t total_bytes_processed = (associated_data.size() + plaintext.size()) * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+  state.SetItemsProcessed(num_packets * state.iterations());
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+BENCHMARK(ascon_aead128_encrypt_burst<true>)
+  ->Name("ascon_aead128_encrypt_burst")
+  ->ArgsProduct({
+    { 32 },            // Associated data
+    { 64, 256, 1500 }, // Plain text
+    { 32 },            // Packets per burst
+  })
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(ascon_aead128_encrypt_burst<false>)
+  ->Name("ascon_aead128_encrypt_one_by_one")
+  ->ArgsProduct({
+    { 32 },            // Associated data
+    { 64, 256, 1500 }, // Plain text
+    { 32 },            // Packets per burst
+  })
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
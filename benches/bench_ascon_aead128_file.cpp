@@ -0,0 +1,150 @@
+#include "ascon/aead/ascon_aead128_file.hpp"
+#include "bench_helper.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+
+// Reports per-thread throughput, next to the overall one, so that scaling efficiency can be read off as their ratio against the single thread run.
+static void
+set_throughput_counters(benchmark::State& state, const size_t byte_len, const size_t num_threads)
+{
+  state.SetBytesProcessed(static_cast<int64_t>(byte_len * state.iterations()));
+  state.counters["bytes_per_thread_per_second"] = benchmark::Counter(static_cast<double>(byte_len * state.iterations()) / static_cast<double>(num_threads),
+                                                                     benchmark::Counter::kIsRate,
+                                                                     benchmark::Counter::kIs1024);
+}
+
+// Encrypts whole plaintext buffer, into a preallocated output, with segments spread over a pool of given number of threads.
+static void
+bench_ascon_aead128_file_encrypt(benchmark::State& state)
+{
+  const size_t pt_byte_len = static_cast<size_t>(state.range(0));
+  const size_t num_threads = static_cast<size_t>(state.range(1));
+
+  std::array<uint8_t, ascon_aead128_file::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_file::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::vector<uint8_t> plaintext(pt_byte_len);
+  std::vector<uint8_t> encrypted(ascon_aead128_file::encrypted_byte_len(pt_byte_len, ascon_aead128_file::DEFAULT_SEGMENT_BYTE_LEN));
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(plaintext);
+
+  ascon_parallel::thread_pool_t pool(num_threads);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(plaintext);
+    benchmark::DoNotOptimize(encrypted);
+
+    assert(ascon_aead128_file::encrypt(pool, key, nonce_prefix, {}, plaintext, encrypted) == ascon_aead128_file::ascon_aead128_file_status_t::encrypted);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_throughput_counters(state, pt_byte_len, num_threads);
+}
+
+// Decrypts whole encrypted buffer, verifying tags of all segments, with segments spread over a pool of given number of threads.
+static void
+bench_ascon_aead128_file_decrypt(benchmark::State& state)
+{
+  const size_t pt_byte_len = static_cast<size_t>(state.range(0));
+  const size_t num_threads = static_cast<size_t>(state.range(1));
+
+  std::array<uint8_t, ascon_aead128_file::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_file::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::vector<uint8_t> plaintext(pt_byte_len);
+  std::vector<uint8_t> encrypted(ascon_aead128_file::encrypted_byte_len(pt_byte_len, ascon_aead128_file::DEFAULT_SEGMENT_BYTE_LEN));
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(plaintext);
+
+  ascon_parallel::thread_pool_t pool(num_threads);
+
+  assert(ascon_aead128_file::encrypt(pool, key, nonce_prefix, {}, plaintext, encrypted) == ascon_aead128_file::ascon_aead128_file_status_t::encrypted);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(encrypted);
+    benchmark::DoNotOptimize(plaintext);
+
+    assert(ascon_aead128_file::decrypt(pool, key, {}, encrypted, plaintext) == ascon_aead128_file::ascon_aead128_file_status_t::decrypted);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_throughput_counters(state, pt_byte_len, num_threads);
+}
+
+// Encrypts a file into another one, both memory mapped, with segments spread over a pool of given number of threads. Includes cost of creating and
+// preallocating the output file, which stays in the page cache.
+static void
+bench_ascon_aead128_file_encrypt_file(benchmark::State& state)
+{
+  const size_t pt_byte_len = static_cast<size_t>(state.range(0));
+  const size_t num_threads = static_cast<size_t>(state.range(1));
+
+  std::array<uint8_t, ascon_aead128_file::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_file::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::vector<uint8_t> plaintext(pt_byte_len);
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(plaintext);
+
+  std::string in_path = "/tmp/ascon_aead128_file_bench_XXXXXX";
+  const int fd = ::mkstemp(in_path.data());
+  if ((fd < 0) || (::write(fd, plaintext.data(), plaintext.size()) != static_cast<ssize_t>(plaintext.size()))) {
+    state.SkipWithError("failed to write input file");
+    return;
+  }
+  ::close(fd);
+
+  const std::string out_path = in_path + ".enc";
+  ascon_parallel::thread_pool_t pool(num_threads);
+
+  for (auto _ : state) {
+    const auto status = ascon_aead128_file::encrypt_file(pool, key, nonce_prefix, {}, in_path.c_str(), out_path.c_str());
+    benchmark::DoNotOptimize(status);
+  }
+
+  set_throughput_counters(state, pt_byte_len, num_threads);
+
+  ::unlink(in_path.c_str());
+  ::unlink(out_path.c_str());
+}
+
+BENCHMARK(bench_ascon_aead128_file_encrypt)
+  ->Name("ascon_aead128_file_encrypt")
+  ->ArgsProduct({
+    { 256 * 1'024 * 1'024 }, // Plain text
+    { 1, 2, 4, 8, 16 },      // Threads
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_aead128_file_decrypt)
+  ->Name("ascon_aead128_file_decrypt")
+  ->ArgsProduct({
+    { 256 * 1'024 * 1'024 }, // Cipher text
+    { 1, 2, 4, 8, 16 },      // Threads
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_aead128_file_encrypt_file)
+  ->Name("ascon_aead128_file_encrypt_file")
+  ->ArgsProduct({
+    { 256 * 1'024 * 1'024 }, // Plain text
+    { 1, 2, 4, 8, 16 },      // Threads
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
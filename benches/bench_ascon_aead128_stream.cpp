@@ -0,0 +1,132 @@
+#include "ascon/aead/ascon_aead128.hpp"
+#include "ascon/aead/ascon_aead128_stream.hpp"
+#include "bench_helper.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+
+// Encrypts whole plaintext as a stream of 64KB segments, using multi-lane Ascon permutation and given number of threads.
+static void
+bench_ascon_aead128_stream_encrypt(benchmark::State& state)
+{
+  const size_t pt_byte_len = static_cast<size_t>(state.range(0));
+  const size_t num_threads = static_cast<size_t>(state.range(1));
+  ascon_parallel::thread_pool_t pool(num_threads);
+
+  std::array<uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::array<uint8_t, 32> associated_data{};
+  std::vector<uint8_t> plaintext(pt_byte_len);
+  std::vector<uint8_t> stream(ascon_aead128_stream::encrypted_stream_byte_len(pt_byte_len, ascon_aead128_stream::DEFAULT_SEGMENT_BYTE_LEN));
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(associated_data);
+  generate_random_data<uint8_t>(plaintext);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(plaintext);
+    benchmark::DoNotOptimize(stream);
+
+    assert(ascon_aead128_stream::encrypt(pool, key, nonce_prefix, associated_data, plaintext, stream) ==
+           ascon_aead128_stream::ascon_aead128_stream_status_t::encrypted_stream);
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(pt_byte_len * state.iterations());
+}
+
+// Decrypts whole stream of 64KB segments, verifying each of them, using multi-lane Ascon permutation and given number of threads.
+static void
+bench_ascon_aead128_stream_decrypt(benchmark::State& state)
+{
+  const size_t pt_byte_len = static_cast<size_t>(state.range(0));
+  const size_t num_threads = static_cast<size_t>(state.range(1));
+  ascon_parallel::thread_pool_t pool(num_threads);
+
+  std::array<uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::array<uint8_t, 32> associated_data{};
+  std::vector<uint8_t> plaintext(pt_byte_len);
+  std::vector<uint8_t> stream(ascon_aead128_stream::encrypted_stream_byte_len(pt_byte_len, ascon_aead128_stream::DEFAULT_SEGMENT_BYTE_LEN));
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(associated_data);
+  generate_random_data<uint8_t>(plaintext);
+
+  assert(ascon_aead128_stream::encrypt(pool, key, nonce_prefix, associated_data, plaintext, stream) ==
+         ascon_aead128_stream::ascon_aead128_stream_status_t::encrypted_stream);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stream);
+    benchmark::DoNotOptimize(plaintext);
+
+    assert(ascon_aead128_stream::decrypt(pool, key, nonce_prefix, associated_data, stream, plaintext) ==
+           ascon_aead128_stream::ascon_aead128_stream_status_t::decrypted_stream);
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(pt_byte_len * state.iterations());
+}
+
+// Encrypts whole plaintext using a single, monolithic Ascon-AEAD128 call, as a baseline.
+static void
+bench_ascon_aead128_monolithic_seal(benchmark::State& state)
+{
+  const size_t pt_byte_len = static_cast<size_t>(state.range(0));
+
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  std::array<uint8_t, 32> associated_data{};
+  std::vector<uint8_t> plaintext(pt_byte_len);
+  std::vector<uint8_t> ciphertext_and_tag(pt_byte_len + ascon_aead128::TAG_BYTE_LEN);
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce);
+  generate_random_data<uint8_t>(associated_data);
+  generate_random_data<uint8_t>(plaintext);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(plaintext);
+    benchmark::DoNotOptimize(ciphertext_and_tag);
+
+    assert(ascon_aead128::seal(key, nonce, associated_data, plaintext, ciphertext_and_tag) == ascon_aead128::ascon_aead128_status_t::sealed);
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(pt_byte_len * state.iterations());
+}
+
+BENCHMARK(bench_ascon_aead128_stream_encrypt)
+  ->Name("ascon_aead128_stream_encrypt")
+  ->ArgsProduct({
+    { 1 * 1'024 * 1'024, 64 * 1'024 * 1'024 }, // Plain text
+    { 1, 2, 4, 8, 16 },                        // Threads
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_aead128_stream_decrypt)
+  ->Name("ascon_aead128_stream_decrypt")
+  ->ArgsProduct({
+    { 1 * 1'024 * 1'024, 64 * 1'024 * 1'024 }, // Cipher text
+    { 1, 2, 4, 8, 16 },                        // Threads
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_aead128_monolithic_seal)
+  ->Name("ascon_aead128_monolithic_seal")
+  ->ArgsProduct({
+    { 1 * 1'024 * 1'024, 64 * 1'024 * 1'024 }, // Plain text
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
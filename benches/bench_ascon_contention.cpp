@@ -0,0 +1,297 @@
+#include "ascon/aead/ascon_aead128.hpp"
+#include "ascon/hashes/ascon_hash256.hpp"
+#include "ascon/hashes/ascon_xof128.hpp"
+#include "bench_helper.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <pthread.h>
+#include <random>
+#include <sched.h>
+#include <string_view>
+#include <utility>
+
+// Runs Ascon workloads concurrently, on 1..64 threads, each pinned to its own CPU (wrapping around, when there are fewer CPUs), working on its own set of
+// distinct connections i.e. keys, nonces and buffers. Cycling through a working set of many connections, per thread, evicts them from the cache between
+// uses, as it happens on a busy server, while a single connection per thread stays hot in L1. Aggregate throughput is reported as `bytes_per_second`, while
+// `bytes_per_thread_per_second` is the average per-thread one and `efficiency` is the latter relative to that of the single thread run of the same workload
+// and working set (1.0 being perfect scaling). These are run only by `make benchmark_contention`.
+
+// Pins calling thread to a CPU, picked by its index among the allowed ones, restoring the original affinity when going out of scope.
+struct scoped_cpu_pin_t
+{
+  cpu_set_t original{};
+  bool is_pinned = false;
+
+  explicit scoped_cpu_pin_t(const int thread_index)
+  {
+    if (sched_getaffinity(0, sizeof(original), &original) != 0) {
+      return;
+    }
+
+    const int num_cpus = CPU_COUNT(&original);
+    if (num_cpus == 0) {
+      return;
+    }
+
+    int target = thread_index % num_cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (!CPU_ISSET(cpu, &original)) {
+        continue;
+      }
+      if (target-- > 0) {
+        continue;
+      }
+
+      cpu_set_t pinned{};
+      CPU_ZERO(&pinned);
+      CPU_SET(cpu, &pinned);
+
+      is_pinned = pthread_setaffinity_np(pthread_self(), sizeof(pinned), &pinned) == 0;
+      break;
+    }
+  }
+
+  ~scoped_cpu_pin_t()
+  {
+    if (is_pinned) {
+      (void)pthread_setaffinity_np(pthread_self(), sizeof(original), &original);
+    }
+  }
+};
+
+// Working sets are large, so they are filled using a single, cheaply seeded generator, rather than `generate_random_data`, which seeds a new one each call.
+static void
+fill_random(std::span<uint8_t> bytes, std::mt19937_64& gen)
+{
+  for (auto& b : bytes) {
+    b = static_cast<uint8_t>(gen());
+  }
+}
+
+// Measures wall-clock time a thread spends in the benchmark loop, starting from its first iteration, so that neither setup of the working set, nor waiting for
+// other threads to be done with theirs, is counted.
+struct loop_timer_t
+{
+  std::chrono::steady_clock::time_point start{};
+  bool is_started = false;
+
+  void start_once()
+  {
+    if (!is_started) {
+      start = std::chrono::steady_clock::now();
+      is_started = true;
+    }
+  }
+
+  [[nodiscard]]
+  double elapsed_seconds() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+};
+
+// Throughput of the latest single thread run of each workload and working set, which multi-threaded runs are compared against. Single thread run is
+// registered, and hence run, before the multi-threaded ones.
+static std::mutex single_thread_throughputs_lock;
+static std::map<std::pair<std::string_view, int64_t>, double> single_thread_throughputs;
+
+static void
+set_throughput_counters(benchmark::State& state, const size_t bytes_per_iteration, const std::string_view workload, const loop_timer_t& timer)
+{
+  const auto total_bytes_processed = static_cast<double>(bytes_per_iteration * state.iterations());
+  const double thread_throughput = total_bytes_processed / timer.elapsed_seconds();
+
+  state.SetBytesProcessed(static_cast<int64_t>(bytes_per_iteration * state.iterations()));
+  state.counters["bytes_per_thread_per_second"] =
+    benchmark::Counter(total_bytes_processed, benchmark::Counter::kIsRate | benchmark::Counter::kAvgThreads, benchmark::Counter::kIs1024);
+
+  std::lock_guard lock(single_thread_throughputs_lock);
+
+  const auto key = std::make_pair(workload, state.range(0));
+  if (state.threads() == 1) {
+    single_thread_throughputs[key] = thread_throughput;
+  }
+
+  // No single thread run to compare against, when it's filtered out.
+  if (const auto it = single_thread_throughputs.find(key); it != single_thread_throughputs.end()) {
+    state.counters["efficiency"] = benchmark::Counter(thread_throughput / it->second, benchmark::Counter::kAvgThreads);
+  }
+}
+
+// Working set (number of distinct connections per thread) x threads.
+static void
+contention_args(benchmark::internal::Benchmark* b)
+{
+  b->ArgName("working_set");
+  for (const int64_t working_set : { 1, 256, 16 * 1'024, 256 * 1'024 }) {
+    b->Arg(working_set);
+  }
+  for (const int num_threads : { 1, 2, 4, 8, 16, 32, 64 }) {
+    b->Threads(num_threads);
+  }
+}
+
+// Seals 64 -bytes packets, with 16 -bytes associated data, in-place, using pre-parsed key of each connection.
+static void
+bench_ascon_aead128_seal_contended(benchmark::State& state)
+{
+  constexpr size_t AD_BYTE_LEN = 16;
+  constexpr size_t PT_BYTE_LEN = 64;
+
+  struct connection_t
+  {
+    ascon_aead128::ascon_aead128_key_t key_ctx;
+    std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+    std::array<uint8_t, AD_BYTE_LEN> associated_data{};
+    std::array<uint8_t, PT_BYTE_LEN + ascon_aead128::TAG_BYTE_LEN> buffer{};
+  };
+
+  const scoped_cpu_pin_t pin(state.thread_index());
+  const size_t working_set = static_cast<size_t>(state.range(0));
+  std::mt19937_64 gen(static_cast<uint64_t>(state.thread_index()));
+
+  std::vector<connection_t> connections;
+  connections.reserve(working_set);
+
+  for (size_t i = 0; i < working_set; i++) {
+    std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+    fill_random(key, gen);
+
+    auto& conn = connections.emplace_back(connection_t{ .key_ctx = ascon_aead128::ascon_aead128_key_t(key) });
+    fill_random(conn.nonce, gen);
+    fill_random(conn.associated_data, gen);
+    fill_random(conn.buffer, gen);
+  }
+
+  size_t conn_idx = 0;
+  loop_timer_t timer;
+
+  for (auto _ : state) {
+    timer.start_once();
+
+    auto& conn = connections[conn_idx];
+    conn_idx = (conn_idx + 1 == working_set) ? 0 : conn_idx + 1;
+
+    conn.nonce[0]++;
+    benchmark::DoNotOptimize(conn);
+
+    auto buffer = std::span(conn.buffer);
+    assert(ascon_aead128::seal(conn.key_ctx, conn.nonce, conn.associated_data, buffer.first<PT_BYTE_LEN>(), buffer) ==
+           ascon_aead128::ascon_aead128_status_t::sealed);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_throughput_counters(state, AD_BYTE_LEN + PT_BYTE_LEN, "aead128_seal", timer);
+}
+
+// Hashes 64 -bytes messages, each into its own digest.
+static void
+bench_ascon_hash256_contended(benchmark::State& state)
+{
+  constexpr size_t MSG_BYTE_LEN = 64;
+
+  struct message_t
+  {
+    std::array<uint8_t, MSG_BYTE_LEN> msg{};
+    std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+  };
+
+  const scoped_cpu_pin_t pin(state.thread_index());
+  const size_t working_set = static_cast<size_t>(state.range(0));
+  std::mt19937_64 gen(static_cast<uint64_t>(state.thread_index()));
+
+  std::vector<message_t> messages(working_set);
+  for (auto& m : messages) {
+    fill_random(m.msg, gen);
+  }
+
+  size_t msg_idx = 0;
+  loop_timer_t timer;
+
+  for (auto _ : state) {
+    timer.start_once();
+
+    auto& m = messages[msg_idx];
+    msg_idx = (msg_idx + 1 == working_set) ? 0 : msg_idx + 1;
+
+    benchmark::DoNotOptimize(m);
+
+    ascon_hash256::ascon_hash256_t hasher;
+    assert(hasher.absorb(m.msg) == ascon_hash256::ascon_hash256_status_t::absorbed_data);
+    assert(hasher.finalize() == ascon_hash256::ascon_hash256_status_t::finalized_data_absorption_phase);
+    assert(hasher.digest(m.digest) == ascon_hash256::ascon_hash256_status_t::message_digest_produced);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_throughput_counters(state, MSG_BYTE_LEN, "hash256", timer);
+}
+
+// Squeezes 64 -bytes output from 64 -bytes messages, each into its own output buffer.
+static void
+bench_ascon_xof128_contended(benchmark::State& state)
+{
+  constexpr size_t MSG_BYTE_LEN = 64;
+  constexpr size_t OUT_BYTE_LEN = 64;
+
+  struct message_t
+  {
+    std::array<uint8_t, MSG_BYTE_LEN> msg{};
+    std::array<uint8_t, OUT_BYTE_LEN> output{};
+  };
+
+  const scoped_cpu_pin_t pin(state.thread_index());
+  const size_t working_set = static_cast<size_t>(state.range(0));
+  std::mt19937_64 gen(static_cast<uint64_t>(state.thread_index()));
+
+  std::vector<message_t> messages(working_set);
+  for (auto& m : messages) {
+    fill_random(m.msg, gen);
+  }
+
+  size_t msg_idx = 0;
+  loop_timer_t timer;
+
+  for (auto _ : state) {
+    timer.start_once();
+
+    auto& m = messages[msg_idx];
+    msg_idx = (msg_idx + 1 == working_set) ? 0 : msg_idx + 1;
+
+    benchmark::DoNotOptimize(m);
+
+    ascon_xof128::ascon_xof128_t hasher;
+    assert(hasher.absorb(m.msg) == ascon_xof128::ascon_xof128_status_t::absorbed_data);
+    assert(hasher.finalize() == ascon_xof128::ascon_xof128_status_t::finalized_data_absorption_phase);
+    assert(hasher.squeeze(m.output) == ascon_xof128::ascon_xof128_status_t::squeezed_output);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_throughput_counters(state, MSG_BYTE_LEN + OUT_BYTE_LEN, "xof128", timer);
+}
+
+BENCHMARK(bench_ascon_aead128_seal_contended)
+  ->Name("ascon_aead128_seal_contended")
+  ->Apply(contention_args)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_hash256_contended)
+  ->Name("ascon_hash256_contended")
+  ->Apply(contention_args)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_xof128_contended)
+  ->Name("ascon_xof128_contended")
+  ->Apply(contention_args)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
@@ -0,0 +1,82 @@
+#include "ascon/hashes/ascon_cxof128.hpp"
+#include "bench_helper.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+
+// Derives a 32 -byte output from a 32 -byte input, customizing each Ascon-CXOF128 instance with the same string, all over again.
+static void
+bench_ascon_cxof128_customize_each_time(benchmark::State& state)
+{
+  const size_t cust_str_byte_len = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> cust_str(cust_str_byte_len);
+  std::array<uint8_t, 32> msg{};
+  std::array<uint8_t, 32> output{};
+
+  generate_random_data<uint8_t>(cust_str);
+  generate_random_data<uint8_t>(msg);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cust_str);
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(output);
+
+    ascon_cxof128::ascon_cxof128_t hasher;
+    assert(hasher.customize(cust_str) == ascon_cxof128::ascon_cxof128_status_t::customized);
+    assert(hasher.absorb(msg) == ascon_cxof128::ascon_cxof128_status_t::absorbed_data);
+    assert(hasher.finalize() == ascon_cxof128::ascon_cxof128_status_t::finalized_data_absorption_phase);
+    assert(hasher.squeeze(output) == ascon_cxof128::ascon_cxof128_status_t::squeezed_output);
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Same as above, but each Ascon-CXOF128 instance starts from the prefix state, customized only once.
+static void
+bench_ascon_cxof128_from_prefix(benchmark::State& state)
+{
+  const size_t cust_str_byte_len = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> cust_str(cust_str_byte_len);
+  std::array<uint8_t, 32> msg{};
+  std::array<uint8_t, 32> output{};
+
+  generate_random_data<uint8_t>(cust_str);
+  generate_random_data<uint8_t>(msg);
+
+  ascon_cxof128::ascon_cxof128_prefix_t prefix;
+  assert(prefix.customize(cust_str) == ascon_cxof128::ascon_cxof128_status_t::customized);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(prefix);
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(output);
+
+    ascon_cxof128::ascon_cxof128_t hasher(prefix);
+    assert(hasher.absorb(msg) == ascon_cxof128::ascon_cxof128_status_t::absorbed_data);
+    assert(hasher.finalize() == ascon_cxof128::ascon_cxof128_status_t::finalized_data_absorption_phase);
+    assert(hasher.squeeze(output) == ascon_cxof128::ascon_cxof128_status_t::squeezed_output);
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bench_ascon_cxof128_customize_each_time)
+  ->Name("ascon_cxof128_customize_each_time")
+  ->Arg(16)
+  ->Arg(64)
+  ->Arg(256) // Customization string length
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_cxof128_from_prefix)
+  ->Name("ascon_cxof128_from_prefix")
+  ->Arg(16)
+  ->Arg(64)
+  ->Arg(256) // Customization string length
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
@@ -0,0 +1,83 @@
+#include "ascon/utils/file.hpp"
+#include "bench_helper.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+
+// Hashes a temporary file of given length, using given method of accessing its content. File is written right before benchmarking, so it's most likely
+// already in page cache - this measures cost of getting bytes from the kernel, not from the storage device.
+template<const ascon_file::ascon_file_read_method_t method>
+static void
+bench_ascon_hash_file(benchmark::State& state)
+{
+  const size_t file_byte_len = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> content(file_byte_len);
+  std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+  generate_random_data<uint8_t>(content);
+
+  std::string path = "/tmp/ascon_bench_file_XXXXXX";
+  const int fd = ::mkstemp(path.data());
+  if (fd < 0) {
+    state.SkipWithError("Failed to create temporary file");
+    return;
+  }
+
+  for (size_t off = 0; off < content.size();) {
+    const ssize_t n = ::write(fd, content.data() + off, content.size() - off);
+    if (n <= 0) {
+      ::close(fd);
+      ::unlink(path.c_str());
+
+      state.SkipWithError("Failed to write temporary file");
+      return;
+    }
+    off += static_cast<size_t>(n);
+  }
+  ::close(fd);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(digest);
+
+    assert(ascon_file::hash_file(path.c_str(), digest, method) == ascon_file::ascon_file_status_t::processed_file);
+
+    benchmark::ClobberMemory();
+  }
+
+  ::unlink(path.c_str());
+
+  const size_t total_bytes_processed = file_byte_len * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+BENCHMARK(bench_ascon_hash_file<ascon_file::ascon_file_read_method_t::mmap>)
+  ->Name("ascon_hash256_file_mmap")
+  ->ArgsProduct({ {
+    4 * 1'024,
+    64 * 1'024,
+    1'024 * 1'024,
+    64 * 1'024 * 1'024,
+    256 * 1'024 * 1'024,
+  } })
+  ->Unit(benchmark::kMillisecond)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_hash_file<ascon_file::ascon_file_read_method_t::buffered_read>)
+  ->Name("ascon_hash256_file_read")
+  ->ArgsProduct({ {
+    4 * 1'024,
+    64 * 1'024,
+    1'024 * 1'024,
+    64 * 1'024 * 1'024,
+    256 * 1'024 * 1'024,
+  } })
+  ->Unit(benchmark::kMillisecond)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
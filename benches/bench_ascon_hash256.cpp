@@ -38,8 +38,84 @@ BENCHMARK(bench_ascon_hash256)
   ->ArgsProduct({ {
     32,
     64,
+    128,
     2 * 1'024,
     16 * 1'024,
+    64 * 1'024,
+    1'024 * 1'024,
   } })
   ->ComputeStatistics("min", compute_min)
   ->ComputeStatistics("max", compute_max);
+
+static void
+bench_ascon_hash256_many(benchmark::State& state)
+{
+  const size_t msg_byte_len = static_cast<size_t>(state.range(0));
+  const size_t num_msgs = static_cast<size_t>(state.range(1));
+
+  std::vector<uint8_t> msgs(msg_byte_len * num_msgs);
+  std::vector<std::span<const uint8_t>> msg_spans(num_msgs);
+  std::vector<std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN>> digests(num_msgs);
+
+  generate_random_data<uint8_t>(msgs);
+  for (size_t i = 0; i < num_msgs; i++) {
+    msg_spans[i] = std::span(msgs).subspan(i * msg_byte_len, msg_byte_len);
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(msgs);
+    benchmark::DoNotOptimize(digests);
+
+    assert(ascon_hash256::hash_many(msg_spans, digests) == ascon_hash256::ascon_hash256_status_t::batch_message_digests_produced);
+
+    benchmark::ClobberMemory();
+  }
+
+  const size_t total_bytes_processed = msgs.size() * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+  state.SetItemsProcessed(num_msgs * state.iterations());
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+BENCHMARK(bench_ascon_hash256_many)
+  ->Name("ascon_hash256_many")
+  ->ArgsProduct({
+    { 32, 64, 256, 512 }, // Message length
+    { 64 },               // Number of messages in a batch
+  })
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+// Hashes a message of compile-time known length, using fully unrolled `ascon_hash256::hash`.
+template<const size_t MSG_BYTE_LEN>
+static void
+bench_ascon_hash256_fixed(benchmark::State& state)
+{
+  std::array<uint8_t, MSG_BYTE_LEN> msg{};
+  std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+  generate_random_data<uint8_t>(msg);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(digest);
+
+    ascon_hash256::hash(std::span<const uint8_t, MSG_BYTE_LEN>(msg), std::span(digest));
+
+    benchmark::ClobberMemory();
+  }
+
+  const size_t total_bytes_processed = msg.size() * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+BENCHMARK(bench_ascon_hash256_fixed<32>)->Name("ascon_hash256_fixed/32")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_ascon_hash256_fixed<64>)->Name("ascon_hash256_fixed/64")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_ascon_hash256_fixed<128>)->Name("ascon_hash256_fixed/128")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
@@ -0,0 +1,131 @@
+#include "ascon/hashes/ascon_merkle_tree.hpp"
+#include "bench_helper.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+
+// Each leaf is a 32 -byte value e.g. hash of a record.
+static constexpr size_t LEAF_BYTE_LEN = 32;
+
+// Builds Merkle tree over given number of leaves, level by level, using multi-lane Ascon permutation and given number of threads.
+static void
+bench_ascon_merkle_tree_build(benchmark::State& state)
+{
+  const size_t num_leaves = static_cast<size_t>(state.range(0));
+  const size_t num_threads = static_cast<size_t>(state.range(1));
+  ascon_parallel::thread_pool_t pool(num_threads);
+
+  std::vector<uint8_t> leaf_bytes(num_leaves * LEAF_BYTE_LEN);
+  std::vector<std::span<const uint8_t>> leaves(num_leaves);
+  ascon_merkle_tree::digest_t root{};
+
+  generate_random_data<uint8_t>(leaf_bytes);
+  for (size_t i = 0; i < num_leaves; i++) {
+    leaves[i] = std::span(leaf_bytes).subspan(i * LEAF_BYTE_LEN, LEAF_BYTE_LEN);
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(leaf_bytes);
+    benchmark::DoNotOptimize(root);
+
+    ascon_merkle_tree::ascon_merkle_tree_t tree;
+    tree.build(pool, leaves);
+    assert(tree.root(root) == ascon_merkle_tree::ascon_merkle_tree_status_t::computed_root);
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(num_leaves * state.iterations());
+}
+
+// Builds Merkle tree over given number of leaves, by appending one leaf at a time i.e. hashing one node at a time.
+static void
+bench_ascon_merkle_tree_append(benchmark::State& state)
+{
+  const size_t num_leaves = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> leaf_bytes(num_leaves * LEAF_BYTE_LEN);
+  ascon_merkle_tree::digest_t root{};
+
+  generate_random_data<uint8_t>(leaf_bytes);
+  const auto leaf_bytes_span = std::span<const uint8_t>(leaf_bytes);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(leaf_bytes);
+    benchmark::DoNotOptimize(root);
+
+    ascon_merkle_tree::ascon_merkle_tree_t tree;
+    for (size_t i = 0; i < num_leaves; i++) {
+      tree.append(leaf_bytes_span.subspan(i * LEAF_BYTE_LEN, LEAF_BYTE_LEN));
+    }
+    assert(tree.root(root) == ascon_merkle_tree::ascon_merkle_tree_status_t::computed_root);
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(num_leaves * state.iterations());
+}
+
+// Generates and verifies inclusion proof of a leaf, in a Merkle tree over given number of leaves.
+static void
+bench_ascon_merkle_tree_prove_and_verify(benchmark::State& state)
+{
+  const size_t num_leaves = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> leaf_bytes(num_leaves * LEAF_BYTE_LEN);
+  std::vector<std::span<const uint8_t>> leaves(num_leaves);
+  ascon_merkle_tree::digest_t root{};
+  std::vector<ascon_merkle_tree::digest_t> proof;
+
+  generate_random_data<uint8_t>(leaf_bytes);
+  for (size_t i = 0; i < num_leaves; i++) {
+    leaves[i] = std::span(leaf_bytes).subspan(i * LEAF_BYTE_LEN, LEAF_BYTE_LEN);
+  }
+
+  ascon_merkle_tree::ascon_merkle_tree_t tree;
+  tree.build(ascon_parallel::default_thread_pool(), leaves);
+  assert(tree.root(root) == ascon_merkle_tree::ascon_merkle_tree_status_t::computed_root);
+
+  size_t leaf_idx = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(leaf_idx);
+    benchmark::DoNotOptimize(proof);
+
+    assert(tree.prove(leaf_idx, proof) == ascon_merkle_tree::ascon_merkle_tree_status_t::generated_proof);
+    assert(ascon_merkle_tree::verify(leaves[leaf_idx], leaf_idx, num_leaves, proof, root) ==
+           ascon_merkle_tree::ascon_merkle_tree_status_t::verified_proof);
+
+    leaf_idx = (leaf_idx + 7'919) % num_leaves;
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bench_ascon_merkle_tree_build)
+  ->Name("ascon_merkle_tree_build")
+  ->ArgsProduct({
+    { 1 << 16, 1 << 20, 1 << 24 }, // Leaves
+    { 1, 2, 4, 8, 16 },            // Threads
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_merkle_tree_append)
+  ->Name("ascon_merkle_tree_append")
+  ->ArgsProduct({
+    { 1 << 16, 1 << 20, 1 << 24 }, // Leaves
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_merkle_tree_prove_and_verify)
+  ->Name("ascon_merkle_tree_prove_and_verify")
+  ->ArgsProduct({
+    { 1 << 16, 1 << 20, 1 << 24 }, // Leaves
+  })
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
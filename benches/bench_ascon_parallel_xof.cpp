@@ -0,0 +1,86 @@
+#include "ascon/hashes/ascon_parallel_xof.hpp"
+#include "ascon/hashes/ascon_xof128.hpp"
+#include "bench_helper.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+
+// Generates output of given length from a 32 -byte seed, using parallel XOF, on given number of threads.
+static void
+bench_ascon_parallel_xof(benchmark::State& state)
+{
+  const size_t out_byte_len = static_cast<size_t>(state.range(0));
+  const size_t num_threads = static_cast<size_t>(state.range(1));
+  ascon_parallel::thread_pool_t pool(num_threads);
+
+  std::array<uint8_t, 32> seed{};
+  std::vector<uint8_t> output(out_byte_len);
+
+  generate_random_data<uint8_t>(seed);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(seed);
+    benchmark::DoNotOptimize(output);
+
+    ascon_parallel_xof::generate(pool, seed, output);
+
+    benchmark::ClobberMemory();
+  }
+
+  const size_t total_bytes_processed = out_byte_len * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+// Baseline: squeezes output of given length from a single Ascon-XOF128 instance, after absorbing a 32 -byte seed.
+static void
+bench_ascon_xof128_single_stream(benchmark::State& state)
+{
+  const size_t out_byte_len = static_cast<size_t>(state.range(0));
+
+  std::array<uint8_t, 32> seed{};
+  std::vector<uint8_t> output(out_byte_len);
+
+  generate_random_data<uint8_t>(seed);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(seed);
+    benchmark::DoNotOptimize(output);
+
+    ascon_xof128::ascon_xof128_t xof;
+    assert(xof.absorb(seed) == ascon_xof128::ascon_xof128_status_t::absorbed_data);
+    assert(xof.finalize() == ascon_xof128::ascon_xof128_status_t::finalized_data_absorption_phase);
+    assert(xof.squeeze(output) == ascon_xof128::ascon_xof128_status_t::squeezed_output);
+
+    benchmark::ClobberMemory();
+  }
+
+  const size_t total_bytes_processed = out_byte_len * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+BENCHMARK(bench_ascon_parallel_xof)
+  ->Name("ascon_parallel_xof")
+  ->ArgsProduct({
+    { 1 * 1'024 * 1'024, 16 * 1'024 * 1'024, 64 * 1'024 * 1'024 }, // Output
+    { 1, 2, 4, 8 },                                                 // Threads
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_xof128_single_stream)
+  ->Name("ascon_xof128_single_stream")
+  ->ArgsProduct({
+    { 1 * 1'024 * 1'024, 16 * 1'024 * 1'024, 64 * 1'024 * 1'024 }, // Output
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
@@ -1,8 +1,11 @@
 #include "ascon/permutation/ascon.hpp"
+#include "ascon/permutation/ascon_xN.hpp"
 #include "bench_helper.hpp"
 #include <benchmark/benchmark.h>
+#include <string>
 
-template<const size_t ROUNDS>
+// Benchmarks R -rounds Ascon permutation, using given state representation i.e. `ascon_perm_u64_t` or `ascon_perm_bi32_t`.
+template<typename perm_t, const size_t ROUNDS>
 static void
 ascon_permutation(benchmark::State& state)
   requires(ROUNDS <= ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS)
@@ -10,23 +13,141 @@ ascon_permutation(benchmark::State& state)
   std::array<uint64_t, 5> state_words{};
   generate_random_data<uint64_t>(state_words);
 
-  ascon_perm::ascon_perm_t perm_state(state_words);
+  perm_t perm_state(state_words);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(perm_state);
+    perm_state.template permute<ROUNDS>();
+    benchmark::ClobberMemory();
+  }
+
+  const size_t bytes_processed = sizeof(perm_state) * state.iterations();
+  state.SetBytesProcessed(bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / bytes_processed;
+#endif
+}
+
+BENCHMARK(ascon_permutation<ascon_perm::ascon_perm_u64_t, 1>)
+  ->Name("ascon_permutation<1>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation<ascon_perm::ascon_perm_u64_t, 8>)
+  ->Name("ascon_permutation<8>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation<ascon_perm::ascon_perm_u64_t, 12>)
+  ->Name("ascon_permutation<12>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation<ascon_perm::ascon_perm_u64_t, 16>)
+  ->Name("ascon_permutation<16>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation<ascon_perm::ascon_perm_bi32_t, 1>)
+  ->Name("ascon_permutation_bi32<1>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation<ascon_perm::ascon_perm_bi32_t, 8>)
+  ->Name("ascon_permutation_bi32<8>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation<ascon_perm::ascon_perm_bi32_t, 12>)
+  ->Name("ascon_permutation_bi32<12>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation<ascon_perm::ascon_perm_bi32_t, 16>)
+  ->Name("ascon_permutation_bi32<16>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+#if defined(ASCON_PERM_HAS_AVX512_BACKEND)
+// Benchmarks R -rounds Ascon permutation on a single state, held in one AVX-512 register, for comparing its latency against the scalar one, above.
+template<const size_t ROUNDS>
+static void
+ascon_permutation_avx512_single(benchmark::State& state)
+  requires(ROUNDS <= ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS)
+{
+  if (!ascon_perm::is_backend_supported(ascon_perm::ascon_perm_backend_t::avx512)) {
+    state.SkipWithError("CPU doesn't support AVX-512F");
+    return;
+  }
+
+  std::array<uint64_t, 5> state_words{};
+  generate_random_data<uint64_t>(state_words);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(state_words);
+    ascon_perm_avx512::permute_single<ROUNDS>(state_words, ascon_perm::ASCON_PERMUTATION_ROUND_CONSTANTS);
+    benchmark::ClobberMemory();
+  }
+
+  const size_t bytes_processed = sizeof(state_words) * state.iterations();
+  state.SetBytesProcessed(bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / bytes_processed;
+#endif
+}
+
+BENCHMARK(ascon_permutation_avx512_single<1>)
+  ->Name("ascon_permutation_avx512_single<1>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation_avx512_single<8>)
+  ->Name("ascon_permutation_avx512_single<8>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation_avx512_single<12>)
+  ->Name("ascon_permutation_avx512_single<12>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation_avx512_single<16>)
+  ->Name("ascon_permutation_avx512_single<16>")
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+#endif
+
+// Benchmarks R -rounds Ascon permutation on LANES -many states at once, using the active backend, which is reported as label. Besides throughput, it reports
+// permutations per second i.e. `LANES` and, with libPFM, cycles per permutation i.e. `CYCLES/ LANE`, for comparing backends across machines e.g.
+// `ASCON_PERM_BACKEND=neon` vs `ASCON_PERM_BACKEND=sve` on an Arm node.
+template<const size_t ROUNDS, const size_t LANES>
+static void
+ascon_permutation_xN(benchmark::State& state)
+  requires(ROUNDS <= ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS)
+{
+  state.SetLabel(std::string(ascon_perm::backend_name(ascon_perm::active_backend())));
+
+  ascon_perm::ascon_perm_xN_t<LANES> perm_state;
+
+  for (size_t lane_idx = 0; lane_idx < LANES; lane_idx++) {
+    std::array<uint64_t, 5> state_words{};
+    generate_random_data<uint64_t>(state_words);
+
+    perm_state.set_lane(lane_idx, ascon_perm::ascon_perm_t(state_words));
+  }
 
   for (auto _ : state) {
     benchmark::DoNotOptimize(perm_state);
-    perm_state.permute<ROUNDS>();
+    perm_state.template permute<ROUNDS>();
     benchmark::ClobberMemory();
   }
 
   const size_t bytes_processed = sizeof(perm_state) * state.iterations();
+  const size_t lanes_permuted = LANES * state.iterations();
   state.SetBytesProcessed(bytes_processed);
+  state.counters["LANES"] = benchmark::Counter(lanes_permuted, benchmark::Counter::kIsRate);
 
 #ifdef CYCLES_PER_BYTE
   state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / bytes_processed;
+  state.counters["CYCLES/ LANE"] = state.counters["CYCLES"] / lanes_permuted;
 #endif
 }
 
-BENCHMARK(ascon_permutation<1>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
-BENCHMARK(ascon_permutation<8>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
-BENCHMARK(ascon_permutation<12>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
-BENCHMARK(ascon_permutation<16>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation_xN<8, 2>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation_xN<8, 4>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation_xN<8, 8>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation_xN<12, 2>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation_xN<12, 4>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ascon_permutation_xN<12, 8>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
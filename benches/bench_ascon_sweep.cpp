@@ -0,0 +1,258 @@
+#include "ascon/aead/ascon_aead128.hpp"
+#include "ascon/hashes/ascon_cxof128.hpp"
+#include "ascon/hashes/ascon_hash256.hpp"
+#include "ascon/hashes/ascon_xof128.hpp"
+#include "bench_helper.hpp"
+#include <benchmark/benchmark.h>
+#include <cassert>
+
+// Systematic benchmark matrix of small inputs, where cost is dominated by initialization, finalization and handling of partial blocks, rather than by the
+// per-byte rate. Lengths are swept in 1 -byte steps over [0, 64], so that each partial block length is seen, along with a coarser matrix of length
+// combinations. Run `make benchmark_sweep` to produce a JSON report, comparable with earlier runs, using google-benchmark's `tools/compare.py`.
+
+static constexpr int64_t SWEEP_MAX_BYTE_LEN = 64;
+
+static void
+set_bytes_processed(benchmark::State& state, const size_t bytes_per_iteration)
+{
+  const size_t total_bytes_processed = bytes_per_iteration * state.iterations();
+  state.SetBytesProcessed(static_cast<int64_t>(total_bytes_processed));
+
+#ifdef CYCLES_PER_BYTE
+  if (total_bytes_processed > 0) {
+    state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+  }
+#endif
+}
+
+// Associated data length x plain text length: each swept in 1 -byte steps, with the other one being empty, followed by a coarse matrix of both.
+static void
+aead_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t pt_len = 0; pt_len <= SWEEP_MAX_BYTE_LEN; pt_len++) {
+    b->Args({ 0, pt_len });
+  }
+  for (int64_t ad_len = 1; ad_len <= SWEEP_MAX_BYTE_LEN; ad_len++) {
+    b->Args({ ad_len, 0 });
+  }
+  for (const int64_t ad_len : { 1, 15, 16, 17, 32, 64 }) {
+    for (const int64_t pt_len : { 1, 15, 16, 17, 32, 64, 256, 1'500 }) {
+      b->Args({ ad_len, pt_len });
+    }
+  }
+}
+
+// Message length x output length: message swept in 1 -byte steps, with a 32 -byte output, followed by squeeze dominated combinations of short messages and
+// long outputs.
+static void
+xof_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t msg_len = 0; msg_len <= SWEEP_MAX_BYTE_LEN; msg_len++) {
+    b->Args({ msg_len, 32 });
+  }
+  for (const int64_t msg_len : { 0, 16, 64 }) {
+    for (const int64_t out_len : { 1, 8, 9, 64, 256, 1'024, 4 * 1'024, 16 * 1'024 }) {
+      b->Args({ msg_len, out_len });
+    }
+  }
+}
+
+// Customization string length, swept in 1 -byte steps, followed by a few longer ones, up to the maximum of 256 -bytes.
+static void
+cxof_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t cust_str_len = 0; cust_str_len <= SWEEP_MAX_BYTE_LEN; cust_str_len++) {
+    b->Args({ cust_str_len });
+  }
+  for (const int64_t cust_str_len : { 128, 255, 256 }) {
+    b->Args({ cust_str_len });
+  }
+}
+
+// Seals plaintext into ciphertext followed by tag, in-place, using a pre-parsed key, as done for each packet.
+static void
+bench_ascon_aead128_seal_sweep(benchmark::State& state)
+{
+  const size_t associated_data_len = static_cast<size_t>(state.range(0));
+  const size_t plain_text_len = static_cast<size_t>(state.range(1));
+
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  std::vector<uint8_t> associated_data(associated_data_len);
+  std::vector<uint8_t> buffer(plain_text_len + ascon_aead128::TAG_BYTE_LEN);
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce);
+  generate_random_data<uint8_t>(associated_data);
+  generate_random_data<uint8_t>(buffer);
+
+  const ascon_aead128::ascon_aead128_key_t key_ctx(key);
+  auto buffer_span = std::span(buffer);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(key_ctx);
+    benchmark::DoNotOptimize(nonce);
+    benchmark::DoNotOptimize(associated_data);
+    benchmark::DoNotOptimize(buffer);
+
+    assert(ascon_aead128::seal(key_ctx, nonce, associated_data, buffer_span.first(plain_text_len), buffer_span) ==
+           ascon_aead128::ascon_aead128_status_t::sealed);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_bytes_processed(state, associated_data_len + plain_text_len);
+}
+
+// Opens ciphertext followed by tag, verifying the tag, using a pre-parsed key, as done for each packet.
+static void
+bench_ascon_aead128_open_sweep(benchmark::State& state)
+{
+  const size_t associated_data_len = static_cast<size_t>(state.range(0));
+  const size_t cipher_text_len = static_cast<size_t>(state.range(1));
+
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  std::vector<uint8_t> associated_data(associated_data_len);
+  std::vector<uint8_t> plaintext(cipher_text_len);
+  std::vector<uint8_t> ciphertext_and_tag(cipher_text_len + ascon_aead128::TAG_BYTE_LEN);
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce);
+  generate_random_data<uint8_t>(associated_data);
+  generate_random_data<uint8_t>(plaintext);
+
+  const ascon_aead128::ascon_aead128_key_t key_ctx(key);
+  assert(ascon_aead128::seal(key_ctx, nonce, associated_data, plaintext, ciphertext_and_tag) == ascon_aead128::ascon_aead128_status_t::sealed);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(key_ctx);
+    benchmark::DoNotOptimize(nonce);
+    benchmark::DoNotOptimize(associated_data);
+    benchmark::DoNotOptimize(ciphertext_and_tag);
+    benchmark::DoNotOptimize(plaintext);
+
+    assert(ascon_aead128::open(key_ctx, nonce, associated_data, ciphertext_and_tag, plaintext) ==
+           ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_bytes_processed(state, associated_data_len + cipher_text_len);
+}
+
+static void
+bench_ascon_hash256_sweep(benchmark::State& state)
+{
+  const size_t msg_byte_len = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> msg(msg_byte_len);
+  std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+  generate_random_data<uint8_t>(msg);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(digest);
+
+    ascon_hash256::ascon_hash256_t hasher;
+    assert(hasher.absorb(msg) == ascon_hash256::ascon_hash256_status_t::absorbed_data);
+    assert(hasher.finalize() == ascon_hash256::ascon_hash256_status_t::finalized_data_absorption_phase);
+    assert(hasher.digest(digest) == ascon_hash256::ascon_hash256_status_t::message_digest_produced);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_bytes_processed(state, msg_byte_len);
+}
+
+static void
+bench_ascon_xof128_sweep(benchmark::State& state)
+{
+  const size_t msg_byte_len = static_cast<size_t>(state.range(0));
+  const size_t out_byte_len = static_cast<size_t>(state.range(1));
+
+  std::vector<uint8_t> msg(msg_byte_len);
+  std::vector<uint8_t> output(out_byte_len);
+
+  generate_random_data<uint8_t>(msg);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(output);
+
+    ascon_xof128::ascon_xof128_t hasher;
+    assert(hasher.absorb(msg) == ascon_xof128::ascon_xof128_status_t::absorbed_data);
+    assert(hasher.finalize() == ascon_xof128::ascon_xof128_status_t::finalized_data_absorption_phase);
+    assert(hasher.squeeze(output) == ascon_xof128::ascon_xof128_status_t::squeezed_output);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_bytes_processed(state, msg_byte_len + out_byte_len);
+}
+
+// Derives a 32 -byte output from a 32 -byte input, customizing each Ascon-CXOF128 instance with a string of given length, to expose customization cost.
+static void
+bench_ascon_cxof128_sweep(benchmark::State& state)
+{
+  const size_t cust_str_byte_len = static_cast<size_t>(state.range(0));
+
+  std::vector<uint8_t> cust_str(cust_str_byte_len);
+  std::array<uint8_t, 32> msg{};
+  std::array<uint8_t, 32> output{};
+
+  generate_random_data<uint8_t>(cust_str);
+  generate_random_data<uint8_t>(msg);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cust_str);
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(output);
+
+    ascon_cxof128::ascon_cxof128_t hasher;
+    assert(hasher.customize(cust_str) == ascon_cxof128::ascon_cxof128_status_t::customized);
+    assert(hasher.absorb(msg) == ascon_cxof128::ascon_cxof128_status_t::absorbed_data);
+    assert(hasher.finalize() == ascon_cxof128::ascon_cxof128_status_t::finalized_data_absorption_phase);
+    assert(hasher.squeeze(output) == ascon_cxof128::ascon_cxof128_status_t::squeezed_output);
+
+    benchmark::ClobberMemory();
+  }
+
+  set_bytes_processed(state, cust_str_byte_len + msg.size() + output.size());
+}
+
+BENCHMARK(bench_ascon_aead128_seal_sweep)
+  ->Name("ascon_aead128_seal_sweep")
+  ->ArgNames({ "ad", "pt" })
+  ->Apply(aead_args)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_aead128_open_sweep)
+  ->Name("ascon_aead128_open_sweep")
+  ->ArgNames({ "ad", "ct" })
+  ->Apply(aead_args)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_hash256_sweep)
+  ->Name("ascon_hash256_sweep")
+  ->ArgName("msg")
+  ->DenseRange(0, SWEEP_MAX_BYTE_LEN, 1)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_xof128_sweep)
+  ->Name("ascon_xof128_sweep")
+  ->ArgNames({ "msg", "out" })
+  ->Apply(xof_args)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_cxof128_sweep)
+  ->Name("ascon_cxof128_sweep")
+  ->ArgName("cust")
+  ->Apply(cxof_args)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
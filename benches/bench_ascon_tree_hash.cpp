@@ -0,0 +1,89 @@
+#include "ascon/hashes/ascon_tree_hash.hpp"
+#include "bench_helper.hpp"
+#include <benchmark/benchmark.h>
+
+// Hashes a message of given length, using one-shot Ascon tree hashing, on given number of threads.
+static void
+bench_ascon_tree_hash(benchmark::State& state)
+{
+  const size_t msg_byte_len = static_cast<size_t>(state.range(0));
+  const size_t num_threads = static_cast<size_t>(state.range(1));
+  ascon_parallel::thread_pool_t pool(num_threads);
+
+  std::vector<uint8_t> msg(msg_byte_len);
+  std::array<uint8_t, 32> out{};
+
+  generate_random_data<uint8_t>(msg);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(out);
+
+    ascon_tree_hash::hash(pool, msg, out);
+
+    benchmark::ClobberMemory();
+  }
+
+  const size_t total_bytes_processed = msg_byte_len * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+// Hashes a message of given length, incrementally, absorbing it in 64KB pieces.
+static void
+bench_ascon_tree_hash_incremental(benchmark::State& state)
+{
+  const size_t msg_byte_len = static_cast<size_t>(state.range(0));
+  constexpr size_t PIECE_BYTE_LEN = 64 * 1'024;
+
+  std::vector<uint8_t> msg(msg_byte_len);
+  std::array<uint8_t, 32> out{};
+
+  generate_random_data<uint8_t>(msg);
+  const auto msg_span = std::span<const uint8_t>(msg);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(out);
+
+    ascon_tree_hash::ascon_tree_hash_t hasher;
+    for (size_t off = 0; off < msg_span.size(); off += PIECE_BYTE_LEN) {
+      assert(hasher.absorb(msg_span.subspan(off, std::min(PIECE_BYTE_LEN, msg_span.size() - off))) ==
+             ascon_tree_hash::ascon_tree_hash_status_t::absorbed_data);
+    }
+    assert(hasher.finalize() == ascon_tree_hash::ascon_tree_hash_status_t::finalized_data_absorption_phase);
+    assert(hasher.squeeze(out) == ascon_tree_hash::ascon_tree_hash_status_t::squeezed_output);
+
+    benchmark::ClobberMemory();
+  }
+
+  const size_t total_bytes_processed = msg_byte_len * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+BENCHMARK(bench_ascon_tree_hash)
+  ->Name("ascon_tree_hash")
+  ->ArgsProduct({
+    { 1 * 1'024 * 1'024, 64 * 1'024 * 1'024, 1'024 * 1'024 * 1'024 }, // Message
+    { 1, 2, 4, 8, 16 },                                                 // Threads
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_ascon_tree_hash_incremental)
+  ->Name("ascon_tree_hash_incremental")
+  ->ArgsProduct({
+    { 1 * 1'024 * 1'024, 64 * 1'024 * 1'024, 1'024 * 1'024 * 1'024 }, // Message
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->ComputeStatistics("min", compute_min)
+  ->ComputeStatistics("max", compute_max);
@@ -37,8 +37,39 @@ bench_ascon_xof128(benchmark::State& state)
 BENCHMARK(bench_ascon_xof128)
   ->Name("ascon_xof128")
   ->ArgsProduct({
-    { 32, 64, 2 * 1'024, 16 * 1'024 }, // Input, to be absorbed
-    { 64, 512 }                        // Output, to be squeezed
+    { 32, 64, 128, 2 * 1'024, 16 * 1'024, 64 * 1'024, 1'024 * 1'024 }, // Input, to be absorbed
+    { 64, 512 }                                                 // Output, to be squeezed
   })
   ->ComputeStatistics("min", compute_min)
   ->ComputeStatistics("max", compute_max);
+
+// Computes Ascon-XOF128 output of compile-time known length, over a message of compile-time known length, using fully unrolled `ascon_xof128::xof`.
+template<const size_t MSG_BYTE_LEN, const size_t OUT_BYTE_LEN>
+static void
+bench_ascon_xof128_fixed(benchmark::State& state)
+{
+  std::array<uint8_t, MSG_BYTE_LEN> msg{};
+  std::array<uint8_t, OUT_BYTE_LEN> output{};
+
+  generate_random_data<uint8_t>(msg);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(output);
+
+    ascon_xof128::xof(std::span<const uint8_t, MSG_BYTE_LEN>(msg), std::span(output));
+
+    benchmark::ClobberMemory();
+  }
+
+  const size_t total_bytes_processed = (MSG_BYTE_LEN + OUT_BYTE_LEN) * state.iterations();
+  state.SetBytesProcessed(total_bytes_processed);
+
+#ifdef CYCLES_PER_BYTE
+  state.counters["CYCLES/ BYTE"] = state.counters["CYCLES"] / total_bytes_processed;
+#endif
+}
+
+BENCHMARK(bench_ascon_xof128_fixed<32, 64>)->Name("ascon_xof128_fixed/32/64")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_ascon_xof128_fixed<64, 64>)->Name("ascon_xof128_fixed/64/64")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_ascon_xof128_fixed<128, 64>)->Name("ascon_xof128_fixed/128/64")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
@@ -0,0 +1,16 @@
+LATENCY_BUILD_DIR := $(BUILD_DIR)/latency
+
+LATENCY_DIR := benches/latency
+LATENCY_SOURCES := $(wildcard $(LATENCY_DIR)/*.cpp)
+LATENCY_HEADERS := $(wildcard $(LATENCY_DIR)/*.hpp)
+LATENCY_BINARY := $(LATENCY_BUILD_DIR)/latency.out
+LATENCY_ARGS ?=
+
+$(LATENCY_BUILD_DIR):
+	mkdir -p $@
+
+$(LATENCY_BINARY): $(LATENCY_SOURCES) $(LATENCY_HEADERS) $(LATENCY_BUILD_DIR) $(SUBTLE_INC_DIR)
+	$(CXX) $(CXX_DEFS) $(CXX_FLAGS) $(WARN_FLAGS) $(RELEASE_FLAGS) $(I_FLAGS) $(DEP_IFLAGS) $(LATENCY_SOURCES) -o $@
+
+latency: $(LATENCY_BINARY) ## Build and run per-call latency distribution (p50/ p99/ p99.9) benchmark of Ascon-AEAD128, pass options via LATENCY_ARGS
+	./$< $(LATENCY_ARGS)
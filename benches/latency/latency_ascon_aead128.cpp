@@ -0,0 +1,270 @@
+#include "ascon/aead/ascon_aead128.hpp"
+#include "latency_helper.hpp"
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string_view>
+#include <vector>
+
+// Latency distribution of individual Ascon-AEAD128 operations, on small packets. Each call is timed on its own, with serializing fences around the timestamp
+// reads, and recorded in an HDR style histogram, from which tail percentiles are reported - the metric, google-benchmark's mean over many calls, hides.
+//
+// Usage: latency.out [--iterations N] [--ad-len N] [--pt-len N[,N...]] [--op encrypt|decrypt|seal|open|all] [--cold]
+//
+// With `--cold`, key, nonce, associated data, input and output buffers are evicted from the data cache before each call.
+
+namespace {
+
+constexpr size_t EVICTION_BUFFER_BYTE_LEN = 64 * 1'024 * 1'024;
+constexpr size_t WARMUP_ITERATIONS = 10'000;
+
+struct config_t
+{
+  size_t iterations = 1'000'000;
+  size_t ad_len = 32;
+  std::vector<size_t> pt_lens = { 16, 64, 256, 1'500 };
+  std::string_view op = "all";
+  bool cold = false;
+};
+
+struct packet_t
+{
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN> tag{};
+  std::vector<uint8_t> associated_data;
+  std::vector<uint8_t> plaintext;
+  std::vector<uint8_t> ciphertext;
+  std::vector<uint8_t> ciphertext_and_tag;
+  std::vector<uint8_t> decrypted;
+};
+
+void
+fill_random(std::span<uint8_t> bytes)
+{
+  std::mt19937_64 gen(std::random_device{}());
+  std::uniform_int_distribution<uint32_t> dis(0, 255);
+
+  for (auto& b : bytes) {
+    b = static_cast<uint8_t>(dis(gen));
+  }
+}
+
+template<typename T>
+std::span<const uint8_t>
+as_bytes(const T& obj)
+{
+  return { reinterpret_cast<const uint8_t*>(&obj), sizeof(obj) };
+}
+
+// Streaming encryption, using `ascon_aead128_t`, as done when plaintext arrives piece by piece.
+inline void
+encrypt(packet_t& p)
+{
+  ascon_aead128::ascon_aead128_t handle(p.key, p.nonce);
+  (void)handle.absorb_data(p.associated_data);
+  (void)handle.finalize_data();
+  (void)handle.encrypt_plaintext(p.plaintext, p.ciphertext);
+  (void)handle.finalize_encrypt(p.tag);
+}
+
+inline bool
+decrypt(packet_t& p)
+{
+  ascon_aead128::ascon_aead128_t handle(p.key, p.nonce);
+  (void)handle.absorb_data(p.associated_data);
+  (void)handle.finalize_data();
+  (void)handle.decrypt_ciphertext(p.ciphertext, p.decrypted);
+  return handle.finalize_decrypt(p.tag) == ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches;
+}
+
+// One-shot encryption, using a pre-parsed key, as done for each packet of a connection.
+inline void
+seal(const ascon_aead128::ascon_aead128_key_t& key_ctx, packet_t& p)
+{
+  (void)ascon_aead128::seal(key_ctx, p.nonce, p.associated_data, p.plaintext, p.ciphertext_and_tag);
+}
+
+inline bool
+open(const ascon_aead128::ascon_aead128_key_t& key_ctx, packet_t& p)
+{
+  return ascon_aead128::open(key_ctx, p.nonce, p.associated_data, p.ciphertext_and_tag, p.decrypted) ==
+         ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches;
+}
+
+void
+evict_packet(const packet_t& p, const ascon_aead128::ascon_aead128_key_t& key_ctx, std::span<uint8_t> eviction_buffer)
+{
+  evict_from_cache(p.key, eviction_buffer);
+  evict_from_cache(p.nonce, eviction_buffer);
+  evict_from_cache(p.tag, eviction_buffer);
+  evict_from_cache(p.associated_data, eviction_buffer);
+  evict_from_cache(p.plaintext, eviction_buffer);
+  evict_from_cache(p.ciphertext, eviction_buffer);
+  evict_from_cache(p.ciphertext_and_tag, eviction_buffer);
+  evict_from_cache(p.decrypted, eviction_buffer);
+  evict_from_cache(as_bytes(key_ctx), eviction_buffer);
+}
+
+// Times `iterations` -many calls of `op`, one at a time, after a warm up, and prints percentiles of their latency.
+template<typename F>
+void
+measure(const char* name,
+        const config_t& cfg,
+        const size_t pt_len,
+        const packet_t& packet,
+        const ascon_aead128::ascon_aead128_key_t& key_ctx,
+        const uint64_t timer_overhead,
+        const double ticks_per_ns,
+        std::span<uint8_t> eviction_buffer,
+        F&& op)
+{
+  latency_histogram_t histogram;
+
+  for (size_t i = 0; i < WARMUP_ITERATIONS; i++) {
+    op();
+  }
+
+  for (size_t i = 0; i < cfg.iterations; i++) {
+    if (cfg.cold) {
+      evict_packet(packet, key_ctx, eviction_buffer);
+    }
+
+    const uint64_t begin = latency_timer_t::start();
+    op();
+    const uint64_t end = latency_timer_t::stop();
+
+    const uint64_t elapsed = end - begin;
+    histogram.record(elapsed > timer_overhead ? elapsed - timer_overhead : 0);
+  }
+
+  const auto ns = [&](const uint64_t ticks) { return static_cast<double>(ticks) / ticks_per_ns; };
+
+  std::printf("%-8s %4s %6zu %6zu %10lu %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %11.1f %9.1f\n",
+              name,
+              cfg.cold ? "cold" : "warm",
+              cfg.ad_len,
+              pt_len,
+              static_cast<unsigned long>(histogram.count()),
+              ns(histogram.min()),
+              ns(histogram.value_at_percentile(50)),
+              ns(histogram.value_at_percentile(90)),
+              ns(histogram.value_at_percentile(99)),
+              ns(histogram.value_at_percentile(99.9)),
+              ns(histogram.value_at_percentile(99.99)),
+              ns(histogram.max()),
+              histogram.mean() / ticks_per_ns);
+}
+
+std::vector<size_t>
+parse_lens(const char* arg)
+{
+  std::vector<size_t> lens;
+
+  const char* cur = arg;
+  while (*cur != '\0') {
+    char* end = nullptr;
+    lens.push_back(std::strtoull(cur, &end, 10));
+    cur = (*end == ',') ? end + 1 : end;
+  }
+
+  return lens;
+}
+
+bool
+parse_args(const int argc, char** argv, config_t& cfg)
+{
+  for (int i = 1; i < argc; i++) {
+    const std::string_view arg = argv[i];
+    const bool has_value = (i + 1) < argc;
+
+    if (arg == "--cold") {
+      cfg.cold = true;
+    } else if ((arg == "--iterations") && has_value) {
+      cfg.iterations = std::strtoull(argv[++i], nullptr, 10);
+    } else if ((arg == "--ad-len") && has_value) {
+      cfg.ad_len = std::strtoull(argv[++i], nullptr, 10);
+    } else if ((arg == "--pt-len") && has_value) {
+      cfg.pt_lens = parse_lens(argv[++i]);
+    } else if ((arg == "--op") && has_value) {
+      cfg.op = argv[++i];
+    } else {
+      std::fprintf(stderr,
+                   "Usage: %s [--iterations N] [--ad-len N] [--pt-len N[,N...]] [--op encrypt|decrypt|seal|open|all] [--cold]\n",
+                   argv[0]);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+  config_t cfg;
+  if (!parse_args(argc, argv, cfg)) {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<uint8_t> eviction_buffer;
+#ifndef LATENCY_HAS_TSC
+  if (cfg.cold) {
+    eviction_buffer.resize(EVICTION_BUFFER_BYTE_LEN);
+  }
+#else
+  (void)EVICTION_BUFFER_BYTE_LEN;
+#endif
+
+  const double ticks_per_ns = latency_timer_t::ticks_per_ns();
+  const uint64_t timer_overhead = latency_timer_t::overhead();
+
+  std::printf("# %.3f ticks/ns, timer overhead of %lu ticks subtracted, latencies in ns\n", ticks_per_ns, static_cast<unsigned long>(timer_overhead));
+  std::printf("%-8s %4s %6s %6s %10s %9s %9s %9s %9s %9s %9s %11s %9s\n", "op", "mode", "ad", "pt", "samples", "min", "p50", "p90", "p99", "p99.9", "p99.99",
+              "max", "mean");
+
+  const auto is_selected = [&](const std::string_view op) { return (cfg.op == "all") || (cfg.op == op); };
+
+  for (const size_t pt_len : cfg.pt_lens) {
+    packet_t p;
+    p.associated_data.resize(cfg.ad_len);
+    p.plaintext.resize(pt_len);
+    p.ciphertext.resize(pt_len);
+    p.ciphertext_and_tag.resize(pt_len + ascon_aead128::TAG_BYTE_LEN);
+    p.decrypted.resize(pt_len);
+
+    fill_random(p.key);
+    fill_random(p.nonce);
+    fill_random(p.associated_data);
+    fill_random(p.plaintext);
+
+    const ascon_aead128::ascon_aead128_key_t key_ctx(p.key);
+
+    encrypt(p);
+    seal(key_ctx, p);
+
+    if (!decrypt(p) || !open(key_ctx, p)) {
+      std::fprintf(stderr, "Decryption failed, for plaintext of %zu -bytes\n", pt_len);
+      return EXIT_FAILURE;
+    }
+
+    if (is_selected("encrypt")) {
+      measure("encrypt", cfg, pt_len, p, key_ctx, timer_overhead, ticks_per_ns, eviction_buffer, [&]() { encrypt(p); });
+    }
+    if (is_selected("decrypt")) {
+      measure("decrypt", cfg, pt_len, p, key_ctx, timer_overhead, ticks_per_ns, eviction_buffer, [&]() { (void)decrypt(p); });
+    }
+    if (is_selected("seal")) {
+      measure("seal", cfg, pt_len, p, key_ctx, timer_overhead, ticks_per_ns, eviction_buffer, [&]() { seal(key_ctx, p); });
+    }
+    if (is_selected("open")) {
+      measure("open", cfg, pt_len, p, key_ctx, timer_overhead, ticks_per_ns, eviction_buffer, [&]() { (void)open(key_ctx, p); });
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
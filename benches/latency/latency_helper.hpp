@@ -0,0 +1,187 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <span>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LATENCY_HAS_TSC 1
+#endif
+
+// Reads a timestamp, in ticks of the time-stamp counter, when available, otherwise in nanoseconds, making sure that no instruction of the code being timed
+// is reordered across it. `start` keeps earlier instructions from drifting into the measured region and the read from being executed early, while `stop`
+// waits for all earlier instructions to retire and keeps later ones from starting, before the read completes.
+struct latency_timer_t
+{
+  static inline uint64_t start()
+  {
+#ifdef LATENCY_HAS_TSC
+    _mm_lfence();
+    const uint64_t ticks = __rdtsc();
+    _mm_lfence();
+    return ticks;
+#else
+    timespec ts{};
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ul + static_cast<uint64_t>(ts.tv_nsec);
+#endif
+  }
+
+  static inline uint64_t stop()
+  {
+#ifdef LATENCY_HAS_TSC
+    uint32_t aux = 0;
+    const uint64_t ticks = __rdtscp(&aux);
+    _mm_lfence();
+    return ticks;
+#else
+    return start();
+#endif
+  }
+
+  // Number of ticks per nanosecond, estimated by timing a busy wait of given duration, against the steady clock.
+  static inline double ticks_per_ns(const std::chrono::milliseconds calibration_duration = std::chrono::milliseconds(200))
+  {
+#ifdef LATENCY_HAS_TSC
+    const auto wall_begin = std::chrono::steady_clock::now();
+    const uint64_t tick_begin = start();
+
+    while (std::chrono::steady_clock::now() - wall_begin < calibration_duration) {
+    }
+
+    const uint64_t tick_end = stop();
+    const auto wall_end = std::chrono::steady_clock::now();
+
+    const auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(wall_end - wall_begin).count();
+    return static_cast<double>(tick_end - tick_begin) / static_cast<double>(elapsed_ns);
+#else
+    (void)calibration_duration;
+    return 1.0;
+#endif
+  }
+
+  // Smallest observed cost of an empty timed region, to be subtracted from each sample.
+  static inline uint64_t overhead(const size_t num_samples = 100'000)
+  {
+    uint64_t min_ticks = UINT64_MAX;
+    for (size_t i = 0; i < num_samples; i++) {
+      const uint64_t begin = start();
+      const uint64_t end = stop();
+      min_ticks = std::min(min_ticks, end - begin);
+    }
+    return min_ticks;
+  }
+};
+
+// HDR style histogram, recording non-negative integer samples with bounded relative error. Values are bucketed by their most significant bit and, within
+// that, linearly by the next `SUB_BUCKET_BITS` bits, so that any recorded value is off by at most 2^-SUB_BUCKET_BITS of itself, while the whole 64 -bit range
+// fits in a few thousand counters. Values below 2^SUB_BUCKET_BITS are recorded exactly.
+template<const size_t SUB_BUCKET_BITS = 7>
+struct latency_histogram_t
+{
+private:
+  static constexpr size_t SUB_BUCKET_COUNT = size_t{ 1 } << SUB_BUCKET_BITS;
+  static constexpr size_t BUCKET_COUNT = 64 - SUB_BUCKET_BITS + 1;
+
+  std::vector<uint64_t> counts = std::vector<uint64_t>(BUCKET_COUNT * SUB_BUCKET_COUNT);
+  uint64_t total_count = 0;
+  uint64_t min_value = UINT64_MAX;
+  uint64_t max_value = 0;
+  long double sum = 0;
+
+  static constexpr size_t index_of(const uint64_t value)
+  {
+    if (value < SUB_BUCKET_COUNT) {
+      return static_cast<size_t>(value);
+    }
+
+    const size_t msb = static_cast<size_t>(std::bit_width(value)) - 1;
+    const size_t bucket = msb - SUB_BUCKET_BITS + 1;
+    const size_t sub_bucket = static_cast<size_t>(value >> (msb - SUB_BUCKET_BITS)) - SUB_BUCKET_COUNT;
+
+    return bucket * SUB_BUCKET_COUNT + sub_bucket;
+  }
+
+  // Largest value, which falls in the counter at given index.
+  static constexpr uint64_t highest_value_at(const size_t index)
+  {
+    const size_t bucket = index / SUB_BUCKET_COUNT;
+    const size_t sub_bucket = index % SUB_BUCKET_COUNT;
+
+    if (bucket == 0) {
+      return sub_bucket;
+    }
+
+    const size_t shift = bucket - 1;
+    const uint64_t lowest = static_cast<uint64_t>(SUB_BUCKET_COUNT + sub_bucket) << shift;
+    return lowest + ((uint64_t{ 1 } << shift) - 1);
+  }
+
+public:
+  inline void record(const uint64_t value)
+  {
+    counts[index_of(value)]++;
+    total_count++;
+    min_value = std::min(min_value, value);
+    max_value = std::max(max_value, value);
+    sum += static_cast<long double>(value);
+  }
+
+  inline uint64_t count() const { return total_count; }
+  inline uint64_t min() const { return total_count == 0 ? 0 : min_value; }
+  inline uint64_t max() const { return max_value; }
+  inline double mean() const { return total_count == 0 ? 0 : static_cast<double>(sum / static_cast<long double>(total_count)); }
+
+  // Value, at or below which `percentile` % of the recorded samples are, accurate up to bucket resolution. 100th percentile is the exact maximum.
+  inline uint64_t value_at_percentile(const double percentile) const
+  {
+    if (total_count == 0) {
+      return 0;
+    }
+
+    const auto target = static_cast<uint64_t>(std::max(1.0, (std::min(percentile, 100.0) / 100.0) * static_cast<double>(total_count) + 0.5));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+      seen += counts[i];
+      if (seen >= target) {
+        return std::min(highest_value_at(i), max_value);
+      }
+    }
+
+    return max_value;
+  }
+};
+
+// Evicts given bytes from all levels of the data cache, so that the next access to them misses. Without `clflush`, falls back to streaming through an
+// eviction buffer, much larger than any cache level, which also evicts everything else.
+inline void
+evict_from_cache(std::span<const uint8_t> bytes, std::span<uint8_t> eviction_buffer)
+{
+#ifdef LATENCY_HAS_TSC
+  (void)eviction_buffer;
+
+  constexpr size_t CACHE_LINE_BYTE_LEN = 64;
+  for (size_t off = 0; off < bytes.size(); off += CACHE_LINE_BYTE_LEN) {
+    _mm_clflush(bytes.data() + off);
+  }
+  if (!bytes.empty()) {
+    _mm_clflush(bytes.data() + bytes.size() - 1);
+  }
+  _mm_mfence();
+#else
+  (void)bytes;
+
+  for (size_t off = 0; off < eviction_buffer.size(); off += 64) {
+    eviction_buffer[off]++;
+  }
+#endif
+}
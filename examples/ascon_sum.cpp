@@ -0,0 +1,70 @@
+#include "ascon/utils/file.hpp"
+#include "example_helper.hpp"
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <unistd.h>
+
+// Returns human readable reason of failing to hash a file.
+static const char*
+failure_reason(const ascon_file::ascon_file_status_t status)
+{
+  switch (status) {
+    case ascon_file::ascon_file_status_t::failed_to_open_file:
+      return "can't be opened";
+    case ascon_file::ascon_file_status_t::failed_to_stat_file:
+      return "can't be stat-ed";
+    case ascon_file::ascon_file_status_t::failed_to_map_file:
+      return "can't be memory mapped";
+    case ascon_file::ascon_file_status_t::failed_to_read_file:
+      return "can't be read";
+    default:
+      return "unknown error";
+  }
+}
+
+// Computes Ascon-Hash256 digest of each of given files, printing them in `sha256sum` -like format. A file named "-" denotes standard input.
+//
+// Usage: ascon_sum [--mmap | --read] FILE...
+int
+main(int argc, char** argv)
+{
+  auto method = ascon_file::ascon_file_read_method_t::automatic;
+
+  int arg_idx = 1;
+  if ((arg_idx < argc) && (std::strcmp(argv[arg_idx], "--mmap") == 0)) {
+    method = ascon_file::ascon_file_read_method_t::mmap;
+    arg_idx++;
+  } else if ((arg_idx < argc) && (std::strcmp(argv[arg_idx], "--read") == 0)) {
+    method = ascon_file::ascon_file_read_method_t::buffered_read;
+    arg_idx++;
+  }
+
+  if (arg_idx == argc) {
+    std::cout << "Ascon-Sum\n\n";
+    std::cout << "Usage: " << argv[0] << " [--mmap | --read] FILE...\n";
+    std::cout << "Computes Ascon-Hash256 digest of each FILE, use - for standard input.\n";
+
+    return EXIT_SUCCESS;
+  }
+
+  int exit_code = EXIT_SUCCESS;
+
+  for (; arg_idx < argc; arg_idx++) {
+    const char* path = argv[arg_idx];
+    std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+    const auto status =
+      (std::strcmp(path, "-") == 0) ? ascon_file::hash_fd(STDIN_FILENO, digest, method) : ascon_file::hash_file(path, digest, method);
+
+    if (status != ascon_file::ascon_file_status_t::processed_file) {
+      std::cerr << argv[0] << ": " << path << ": " << failure_reason(status) << "\n";
+      exit_code = EXIT_FAILURE;
+      continue;
+    }
+
+    std::cout << bytes_to_hex_string(digest) << "  " << path << "\n";
+  }
+
+  return exit_code;
+}
@@ -1,8 +1,10 @@
 #pragma once
 #include "ascon/aead/duplex.hpp"
+#include "ascon/aead/duplex_xN.hpp"
 #include "ascon/permutation/ascon.hpp"
 #include "ascon/utils/common.hpp"
 #include "ascon/utils/force_inline.hpp"
+#include "ascon/utils/tracing.hpp"
 #include <algorithm>
 #include <array>
 #include <cstdint>
@@ -55,6 +57,75 @@ enum class ascon_aead128_status_t : uint8_t
 
   /// @brief Indicates that the decryption phase has already been finalized.
   decryption_phase_already_finalized,
+
+  /// @brief Indicates that a burst of packets was processed i.e. each packet was decrypted and its tag was verified.
+  decrypted_burst,
+
+  /// @brief Indicates that the number of packets and the number of per-packet results, in a burst, don't match.
+  batch_size_mismatch,
+
+  /// @brief Indicates that plaintext has been successfully encrypted and authenticated, in one-shot, generating ciphertext and tag.
+  sealed,
+
+  /// @brief Indicates that the length of the output buffer, passed to one-shot seal/open, or described by some packet of a burst, doesn't match the length
+  /// of the input.
+  buffer_length_mismatch,
+
+  /// @brief Indicates that a burst of packets was processed i.e. each packet was encrypted and its tag was produced.
+  encrypted_burst,
+};
+
+/**
+ * @brief Holds an Ascon-AEAD128 key, parsed once into the two 64 -bit words the permutation state is keyed with.
+ *
+ * Meant to be kept around for a long-lived session, where the same key protects many messages, each under its own nonce. Per-message `ascon_aead128_t`
+ * handles are constructed from it, which copy only the parsed key words, neither reparsing nor copying key bytes. Key words are securely wiped, when this
+ * object is destroyed.
+ */
+struct ascon_aead128_key_t
+{
+private:
+  std::array<uint64_t, 2> words{};
+
+public:
+  /**
+   * @brief Constructs an `ascon_aead128_key_t` object, parsing the key into two 64 -bit words.
+   *
+   * @param key The 128-bit encryption key.
+   */
+  forceinline constexpr explicit ascon_aead128_key_t(std::span<const uint8_t, KEY_BYTE_LEN> key)
+  {
+    words[0] = ascon_common_utils::from_le_bytes(key.first<8>());
+    words[1] = ascon_common_utils::from_le_bytes(key.last<8>());
+  }
+
+  /**
+   * @brief Destroys the `ascon_aead128_key_t` object, securely wiping the key words.
+   */
+  forceinline constexpr ~ascon_aead128_key_t() { this->reset(); }
+
+  /**
+   * @brief Returns the first 64 -bit word of the key.
+   */
+  [[nodiscard]]
+  forceinline constexpr uint64_t first_word() const
+  {
+    return words[0];
+  }
+
+  /**
+   * @brief Returns the last 64 -bit word of the key.
+   */
+  [[nodiscard]]
+  forceinline constexpr uint64_t last_word() const
+  {
+    return words[1];
+  }
+
+  /**
+   * @brief Securely wipes the key words, after which this object must not be used for keying any more messages.
+   */
+  forceinline constexpr void reset() { ascon_common_utils::secure_wipe(std::span(words)); }
 };
 
 /**
@@ -67,7 +138,7 @@ enum class ascon_aead128_status_t : uint8_t
 struct ascon_aead128_t
 {
 private:
-  std::array<uint8_t, KEY_BYTE_LEN> key{};
+  std::array<uint64_t, 2> key_words{};
 
   ascon_perm::ascon_perm_t state{};
   size_t offset = 0;
@@ -86,8 +157,29 @@ public:
    */
   forceinline constexpr ascon_aead128_t(std::span<const uint8_t, KEY_BYTE_LEN> key, std::span<const uint8_t, NONCE_BYTE_LEN> nonce)
   {
-    std::copy(key.begin(), key.end(), this->key.begin());
-    ascon_duplex_mode::initialize(state, this->key, nonce);
+    ASCON_TRACE_SCOPE(aead128_init, 0);
+
+    this->key_words[0] = ascon_common_utils::from_le_bytes(key.first<8>());
+    this->key_words[1] = ascon_common_utils::from_le_bytes(key.last<8>());
+
+    ascon_duplex_mode::initialize(state, this->key_words[0], this->key_words[1], nonce);
+  }
+
+  /**
+   * @brief Constructs an `ascon_aead128_t` object, initializing the Ascon state with an already parsed key and the nonce. Cheaper than above, when the same
+   * key is used for many messages.
+   *
+   * @param key The 128-bit encryption key, already parsed into key words.
+   * @param nonce The 128-bit nonce (must be unique for each encryption with the same key).
+   */
+  forceinline constexpr ascon_aead128_t(const ascon_aead128_key_t& key, std::span<const uint8_t, NONCE_BYTE_LEN> nonce)
+  {
+    ASCON_TRACE_SCOPE(aead128_init, 0);
+
+    this->key_words[0] = key.first_word();
+    this->key_words[1] = key.last_word();
+
+    ascon_duplex_mode::initialize(state, this->key_words[0], this->key_words[1], nonce);
   }
 
   /**
@@ -109,6 +201,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_aead128_status_t absorb_data(std::span<const uint8_t> data)
   {
+    ASCON_TRACE_SCOPE(aead128_absorb_data, data.size());
+
     if (finished_absorbing_data) {
       return ascon_aead128_status_t::data_absorption_phase_already_finalized;
     }
@@ -132,6 +226,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_aead128_status_t finalize_data()
   {
+    ASCON_TRACE_SCOPE(aead128_finalize_data, 0);
+
     if (finished_absorbing_data) {
       return ascon_aead128_status_t::data_absorption_phase_already_finalized;
     }
@@ -159,6 +255,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_aead128_status_t encrypt_plaintext(std::span<const uint8_t> plaintext, std::span<uint8_t> ciphertext)
   {
+    ASCON_TRACE_SCOPE(aead128_encrypt_plaintext, plaintext.size());
+
     if (!finished_absorbing_data) {
       return ascon_aead128_status_t::still_in_data_absorption_phase;
     }
@@ -185,6 +283,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_aead128_status_t finalize_encrypt(std::span<uint8_t, TAG_BYTE_LEN> tag)
   {
+    ASCON_TRACE_SCOPE(aead128_finalize_encrypt, 0);
+
     if (!finished_absorbing_data) {
       return ascon_aead128_status_t::still_in_data_absorption_phase;
     }
@@ -194,9 +294,9 @@ public:
 
     ascon_duplex_mode::finalize_ciphering(state, offset);
     finished_encrypting_plaintext = true;
-    ascon_duplex_mode::finalize(state, key, tag);
+    ascon_duplex_mode::finalize(state, key_words[0], key_words[1], tag);
 
-    this->key.fill(0);
+    ascon_common_utils::secure_wipe(std::span(this->key_words));
     this->state.reset();
 
     return ascon_aead128_status_t::finalized_encryption_phase;
@@ -219,6 +319,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_aead128_status_t decrypt_ciphertext(std::span<const uint8_t> ciphertext, std::span<uint8_t> plaintext)
   {
+    ASCON_TRACE_SCOPE(aead128_decrypt_ciphertext, ciphertext.size());
+
     if (!finished_absorbing_data) {
       return ascon_aead128_status_t::still_in_data_absorption_phase;
     }
@@ -246,6 +348,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_aead128_status_t finalize_decrypt(std::span<const uint8_t, TAG_BYTE_LEN> tag)
   {
+    ASCON_TRACE_SCOPE(aead128_finalize_decrypt, 0);
+
     if (!finished_absorbing_data) {
       return ascon_aead128_status_t::still_in_data_absorption_phase;
     }
@@ -258,10 +362,10 @@ public:
 
     std::array<uint8_t, TAG_BYTE_LEN> computed_tag{};
 
-    ascon_duplex_mode::finalize(state, key, computed_tag);
+    ascon_duplex_mode::finalize(state, key_words[0], key_words[1], computed_tag);
     const uint32_t flag = ascon_common_utils::ct_eq_byte_array<TAG_BYTE_LEN>(tag, computed_tag);
 
-    this->key.fill(0);
+    ascon_common_utils::secure_wipe(std::span(this->key_words));
     this->state.reset();
 
     return flag == std::numeric_limits<uint32_t>::max() ? ascon_aead128_status_t::decryption_success_as_tag_matches
@@ -276,7 +380,7 @@ private:
    */
   forceinline constexpr void reset()
   {
-    this->key.fill(0);
+    ascon_common_utils::secure_wipe(std::span(this->key_words));
 
     this->state.reset();
     this->offset = 0;
@@ -288,4 +392,295 @@ private:
   }
 };
 
+/**
+ * @brief Encrypts plaintext and authenticates it, along with associated data, in one-shot, using an already parsed key.
+ *
+ * Runs the whole Ascon-AEAD128 encryption flow, without any of the phase tracking `ascon_aead128_t` does. Ciphertext is written to the first
+ * `plaintext.size()` -bytes of `ciphertext_and_tag`, followed by the tag. For in-place encryption, plaintext can live in the first `plaintext.size()` -bytes
+ * of `ciphertext_and_tag` itself.
+ *
+ * @param key The 128-bit encryption key, already parsed into key words.
+ * @param nonce The 128-bit nonce (must be unique for each encryption with the same key).
+ * @param associated_data Associated data, to be authenticated, but not encrypted.
+ * @param plaintext Plaintext, to be encrypted.
+ * @param ciphertext_and_tag Ciphertext, followed by the tag, to be produced. Must be `plaintext.size() + TAG_BYTE_LEN` -bytes.
+ * @return An `ascon_aead128_status_t` indicating the status of the operation:
+ *   - `sealed`: Plaintext was successfully encrypted and the tag was generated.
+ *   - `buffer_length_mismatch`: Length of `ciphertext_and_tag` is not `plaintext.size() + TAG_BYTE_LEN`, nothing is written.
+ */
+[[nodiscard]]
+forceinline constexpr ascon_aead128_status_t
+seal(const ascon_aead128_key_t& key,
+     std::span<const uint8_t, NONCE_BYTE_LEN> nonce,
+     std::span<const uint8_t> associated_data,
+     std::span<const uint8_t> plaintext,
+     std::span<uint8_t> ciphertext_and_tag)
+{
+  ASCON_TRACE_SCOPE(aead128_seal, associated_data.size() + plaintext.size());
+
+  if (ciphertext_and_tag.size() != (plaintext.size() + TAG_BYTE_LEN)) {
+    return ascon_aead128_status_t::buffer_length_mismatch;
+  }
+
+  const auto ciphertext = ciphertext_and_tag.first(plaintext.size());
+  const auto tag = ciphertext_and_tag.last<TAG_BYTE_LEN>();
+
+  ascon_perm::ascon_perm_t state{};
+  size_t offset = 0;
+
+  ascon_duplex_mode::initialize(state, key.first_word(), key.last_word(), nonce);
+  ascon_duplex_mode::absorb_associated_data(state, offset, associated_data);
+  ascon_duplex_mode::finalize_associated_data(state, offset, associated_data.size());
+  ascon_duplex_mode::encrypt_plaintext(state, offset, plaintext, ciphertext);
+  ascon_duplex_mode::finalize_ciphering(state, offset);
+  ascon_duplex_mode::finalize(state, key.first_word(), key.last_word(), tag);
+
+  state.reset();
+  return ascon_aead128_status_t::sealed;
+}
+
+/**
+ * @brief Same as above, but takes key bytes, which are parsed for this single message.
+ */
+[[nodiscard]]
+forceinline constexpr ascon_aead128_status_t
+seal(std::span<const uint8_t, KEY_BYTE_LEN> key,
+     std::span<const uint8_t, NONCE_BYTE_LEN> nonce,
+     std::span<const uint8_t> associated_data,
+     std::span<const uint8_t> plaintext,
+     std::span<uint8_t> ciphertext_and_tag)
+{
+  const ascon_aead128_key_t key_ctx(key);
+  return seal(key_ctx, nonce, associated_data, plaintext, ciphertext_and_tag);
+}
+
+/**
+ * @brief Decrypts ciphertext and verifies the tag, authenticating it, along with associated data, in one-shot, using an already parsed key.
+ *
+ * Runs the whole Ascon-AEAD128 decryption flow, without any of the phase tracking `ascon_aead128_t` does. Ciphertext is read from the first
+ * `plaintext.size()` -bytes of `ciphertext_and_tag`, followed by the tag. For in-place decryption, plaintext can be written over those first
+ * `plaintext.size()` -bytes of `ciphertext_and_tag` itself. If the tag doesn't match, the plaintext is zeroed, in constant-time, before returning.
+ *
+ * @param key The 128-bit encryption key, already parsed into key words.
+ * @param nonce The 128-bit nonce, which was used during encryption.
+ * @param associated_data Associated data, to be authenticated.
+ * @param ciphertext_and_tag Ciphertext, followed by the tag, to be decrypted and verified. Must be at least `TAG_BYTE_LEN` -bytes.
+ * @param plaintext Plaintext, to be produced. Must be `ciphertext_and_tag.size() - TAG_BYTE_LEN` -bytes.
+ * @return An `ascon_aead128_status_t` indicating the status of the operation:
+ *   - `decryption_success_as_tag_matches`: Decryption was successful and the tag matched.
+ *   - `decryption_failure_due_to_tag_mismatch`: Decryption failed because the tag did not match, plaintext is zeroed.
+ *   - `buffer_length_mismatch`: Length of `plaintext` is not `ciphertext_and_tag.size() - TAG_BYTE_LEN`, nothing is written.
+ */
+[[nodiscard]]
+forceinline constexpr ascon_aead128_status_t
+open(const ascon_aead128_key_t& key,
+     std::span<const uint8_t, NONCE_BYTE_LEN> nonce,
+     std::span<const uint8_t> associated_data,
+     std::span<const uint8_t> ciphertext_and_tag,
+     std::span<uint8_t> plaintext)
+{
+  ASCON_TRACE_SCOPE(aead128_open, associated_data.size() + plaintext.size());
+
+  if ((ciphertext_and_tag.size() < TAG_BYTE_LEN) || (plaintext.size() != (ciphertext_and_tag.size() - TAG_BYTE_LEN))) {
+    return ascon_aead128_status_t::buffer_length_mismatch;
+  }
+
+  const auto ciphertext = ciphertext_and_tag.first(plaintext.size());
+  const auto tag = ciphertext_and_tag.last<TAG_BYTE_LEN>();
+
+  ascon_perm::ascon_perm_t state{};
+  size_t offset = 0;
+
+  std::array<uint8_t, TAG_BYTE_LEN> computed_tag{};
+
+  ascon_duplex_mode::initialize(state, key.first_word(), key.last_word(), nonce);
+  ascon_duplex_mode::absorb_associated_data(state, offset, associated_data);
+  ascon_duplex_mode::finalize_associated_data(state, offset, associated_data.size());
+  ascon_duplex_mode::decrypt_ciphertext(state, offset, ciphertext, plaintext);
+  ascon_duplex_mode::finalize_ciphering(state, offset);
+  ascon_duplex_mode::finalize(state, key.first_word(), key.last_word(), computed_tag);
+
+  const uint32_t flag = ascon_common_utils::ct_eq_byte_array<TAG_BYTE_LEN>(tag, computed_tag);
+  ascon_common_utils::ct_conditional_memset(~flag, plaintext, 0x00);
+
+  state.reset();
+  return flag == std::numeric_limits<uint32_t>::max() ? ascon_aead128_status_t::decryption_success_as_tag_matches
+                                                      : ascon_aead128_status_t::decryption_failure_due_to_tag_mismatch;
+}
+
+/**
+ * @brief Same as above, but takes key bytes, which are parsed for this single message.
+ */
+[[nodiscard]]
+forceinline constexpr ascon_aead128_status_t
+open(std::span<const uint8_t, KEY_BYTE_LEN> key,
+     std::span<const uint8_t, NONCE_BYTE_LEN> nonce,
+     std::span<const uint8_t> associated_data,
+     std::span<const uint8_t> ciphertext_and_tag,
+     std::span<uint8_t> plaintext)
+{
+  const ascon_aead128_key_t key_ctx(key);
+  return open(key_ctx, nonce, associated_data, ciphertext_and_tag, plaintext);
+}
+
+/**
+ * @brief Describes one packet to be encrypted, as part of a burst, using `encrypt_burst`.
+ */
+struct ascon_aead128_encrypt_packet_t
+{
+  /// @brief The 128-bit encryption key.
+  std::span<const uint8_t, KEY_BYTE_LEN> key;
+
+  /// @brief The 128-bit nonce (must be unique for each encryption with the same key).
+  std::span<const uint8_t, NONCE_BYTE_LEN> nonce;
+
+  /// @brief Associated data, to be authenticated, but not encrypted.
+  std::span<const uint8_t> associated_data;
+
+  /// @brief Plaintext, to be encrypted.
+  std::span<const uint8_t> plaintext;
+
+  /// @brief Ciphertext, to be produced. Must be of same length as the plaintext, can alias it for in-place encryption.
+  std::span<uint8_t> ciphertext;
+
+  /// @brief Authentication tag, to be produced.
+  std::span<uint8_t, TAG_BYTE_LEN> tag;
+};
+
+/**
+ * @brief Describes one packet to be decrypted, as part of a burst, using `decrypt_burst`.
+ */
+struct ascon_aead128_decrypt_packet_t
+{
+  /// @brief The 128-bit encryption key.
+  std::span<const uint8_t, KEY_BYTE_LEN> key;
+
+  /// @brief The 128-bit nonce, which was used during encryption.
+  std::span<const uint8_t, NONCE_BYTE_LEN> nonce;
+
+  /// @brief Associated data, to be authenticated.
+  std::span<const uint8_t> associated_data;
+
+  /// @brief Ciphertext, to be decrypted.
+  std::span<const uint8_t> ciphertext;
+
+  /// @brief Plaintext, to be produced. Must be of same length as the ciphertext, can alias it for in-place decryption.
+  std::span<uint8_t> plaintext;
+
+  /// @brief Authentication tag, to be verified.
+  std::span<const uint8_t, TAG_BYTE_LEN> tag;
+};
+
+/**
+ * @brief Encrypts a burst of independent packets, running Ascon-AEAD128 on LANES packets at a time, in lockstep, using the multi-lane Ascon permutation.
+ *
+ * For small packets, cost of Ascon-AEAD128 is dominated by the 12 -rounds initialization and finalization permutations; processing many packets together lets
+ * the permutation work on multiple states at once, using SIMD instructions.
+ *
+ * @param packets A span of packets to be encrypted. Ciphertext and tag of each packet are written to the buffers it describes.
+ * @return An `ascon_aead128_status_t` indicating if the burst was processed (`ascon_aead128_status_t::encrypted_burst`) or if ciphertext of some packet is not
+ * of same length as its plaintext (`ascon_aead128_status_t::buffer_length_mismatch`), in which case no packet is processed.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+forceinline constexpr ascon_aead128_status_t
+encrypt_burst(std::span<const ascon_aead128_encrypt_packet_t> packets)
+{
+  for (const auto& packet : packets) {
+    if (packet.ciphertext.size() != packet.plaintext.size()) {
+      return ascon_aead128_status_t::buffer_length_mismatch;
+    }
+  }
+
+  std::array<std::span<const uint8_t>, LANES> keys{};
+  std::array<std::span<const uint8_t>, LANES> nonces{};
+  std::array<std::span<const uint8_t>, LANES> associated_data{};
+  std::array<std::span<const uint8_t>, LANES> plaintexts{};
+  std::array<std::span<uint8_t>, LANES> ciphertexts{};
+  std::array<std::array<uint8_t, TAG_BYTE_LEN>, LANES> tags{};
+
+  for (size_t off = 0; off < packets.size(); off += LANES) {
+    const size_t num_lanes = std::min(LANES, packets.size() - off);
+
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      const auto& packet = packets[off + lane];
+
+      keys[lane] = packet.key;
+      nonces[lane] = packet.nonce;
+      associated_data[lane] = packet.associated_data;
+      plaintexts[lane] = packet.plaintext;
+      ciphertexts[lane] = packet.ciphertext;
+    }
+
+    ascon_duplex_mode::process_lanes<LANES, false>(num_lanes, keys, nonces, associated_data, plaintexts, ciphertexts, tags);
+
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      std::copy(tags[lane].begin(), tags[lane].end(), packets[off + lane].tag.begin());
+    }
+  }
+
+  ascon_common_utils::secure_wipe(std::span(tags));
+  return ascon_aead128_status_t::encrypted_burst;
+}
+
+/**
+ * @brief Decrypts a burst of independent packets, running Ascon-AEAD128 on LANES packets at a time, in lockstep, using the multi-lane Ascon permutation, and
+ * verifies authentication tag of each of them.
+ *
+ * @param packets A span of packets to be decrypted. Plaintext of each packet is written to the buffer it describes.
+ * @param results A span where per-packet tag verification result is written, must be of same length as `packets`. For each packet, it is either
+ * `decryption_success_as_tag_matches` or `decryption_failure_due_to_tag_mismatch` - in latter case, plaintext of that packet is zeroed, same as `open` does.
+ * @return An `ascon_aead128_status_t` indicating if the burst was processed (`ascon_aead128_status_t::decrypted_burst`), if the number of packets and
+ * results don't match (`ascon_aead128_status_t::batch_size_mismatch`) or if plaintext of some packet is not of same length as its ciphertext
+ * (`ascon_aead128_status_t::buffer_length_mismatch`). In latter two cases, no packet is processed.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+forceinline constexpr ascon_aead128_status_t
+decrypt_burst(std::span<const ascon_aead128_decrypt_packet_t> packets, std::span<ascon_aead128_status_t> results)
+{
+  if (packets.size() != results.size()) {
+    return ascon_aead128_status_t::batch_size_mismatch;
+  }
+  for (const auto& packet : packets) {
+    if (packet.plaintext.size() != packet.ciphertext.size()) {
+      return ascon_aead128_status_t::buffer_length_mismatch;
+    }
+  }
+
+  std::array<std::span<const uint8_t>, LANES> keys{};
+  std::array<std::span<const uint8_t>, LANES> nonces{};
+  std::array<std::span<const uint8_t>, LANES> associated_data{};
+  std::array<std::span<const uint8_t>, LANES> ciphertexts{};
+  std::array<std::span<uint8_t>, LANES> plaintexts{};
+  std::array<std::array<uint8_t, TAG_BYTE_LEN>, LANES> computed_tags{};
+
+  for (size_t off = 0; off < packets.size(); off += LANES) {
+    const size_t num_lanes = std::min(LANES, packets.size() - off);
+
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      const auto& packet = packets[off + lane];
+
+      keys[lane] = packet.key;
+      nonces[lane] = packet.nonce;
+      associated_data[lane] = packet.associated_data;
+      ciphertexts[lane] = packet.ciphertext;
+      plaintexts[lane] = packet.plaintext;
+    }
+
+    ascon_duplex_mode::process_lanes<LANES, true>(num_lanes, keys, nonces, associated_data, ciphertexts, plaintexts, computed_tags);
+
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      const uint32_t flag = ascon_common_utils::ct_eq_byte_array<TAG_BYTE_LEN>(packets[off + lane].tag, computed_tags[lane]);
+      ascon_common_utils::ct_conditional_memset(~flag, packets[off + lane].plaintext, 0x00);
+
+      results[off + lane] = flag == std::numeric_limits<uint32_t>::max() ? ascon_aead128_status_t::decryption_success_as_tag_matches
+                                                                         : ascon_aead128_status_t::decryption_failure_due_to_tag_mismatch;
+    }
+  }
+
+  ascon_common_utils::secure_wipe(std::span(computed_tags));
+  return ascon_aead128_status_t::decrypted_burst;
+}
+
 }
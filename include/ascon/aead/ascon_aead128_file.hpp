@@ -0,0 +1,476 @@
+#pragma once
+#include "ascon/aead/ascon_aead128_stream.hpp"
+#include "ascon/utils/file.hpp"
+#include "ascon/utils/thread_pool.hpp"
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fcntl.h>
+#include <limits>
+#include <span>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// Authenticated encryption of whole buffers and files, using the segmented Ascon-AEAD128 stream of `ascon_aead128_stream`, with segments spread over all
+// threads of a pool. Encrypted object is laid out as
+//
+//   fixed header || tags of all segments, in segment order || ciphertext
+//
+// where the fixed header is
+//
+//   format version (1 -byte) || nonce prefix (11 -bytes) || le32(segment length) || le64(plaintext length)
+//
+// and is authenticated, along with caller supplied associated data, as associated data of each segment. Keeping tags up front, apart from the ciphertext,
+// lets ciphertext be written at a fixed offset in a preallocated output, as each segment gets encrypted, in any order, and be of same length as plaintext.
+namespace ascon_aead128_file {
+
+static constexpr size_t KEY_BYTE_LEN = ascon_aead128_stream::KEY_BYTE_LEN;
+static constexpr size_t TAG_BYTE_LEN = ascon_aead128_stream::TAG_BYTE_LEN;
+static constexpr size_t NONCE_PREFIX_BYTE_LEN = ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN;
+static constexpr size_t DEFAULT_SEGMENT_BYTE_LEN = ascon_aead128_stream::DEFAULT_SEGMENT_BYTE_LEN;
+
+static constexpr uint8_t FORMAT_VERSION = 0x01;
+static constexpr size_t FIXED_HEADER_BYTE_LEN = 1 + NONCE_PREFIX_BYTE_LEN + sizeof(uint32_t) + sizeof(uint64_t);
+
+/**
+ * @brief Represents the status of encrypting or decrypting a buffer or a file.
+ */
+enum class ascon_aead128_file_status_t : uint8_t
+{
+  /// @brief Whole plaintext was successfully encrypted.
+  encrypted = 0x01,
+
+  /// @brief Whole ciphertext was successfully decrypted and tags of all segments matched.
+  decrypted,
+
+  /// @brief Fixed header was successfully parsed.
+  parsed_header,
+
+  /// @brief A file was successfully opened and memory mapped.
+  mapped_file,
+
+  /// @brief Fixed header is truncated, of unknown format version or describes an encrypted object, which is not of the length it should be.
+  malformed_header,
+
+  /// @brief Tag of a segment didn't match - the encrypted object is tampered with. Plaintext, being produced, is zeroed (or the output file is left untouched).
+  decryption_failure_due_to_tag_mismatch,
+
+  /// @brief Plaintext would be split into more than `ascon_aead128_stream::MAX_SEGMENT_COUNT` segments.
+  too_many_segments,
+
+  /// @brief Segment length is zero or doesn't fit in 32 -bits, or length of the output buffer is not what it should be.
+  buffer_length_mismatch,
+
+  /// @brief A file could not be opened.
+  failed_to_open_file,
+
+  /// @brief A file could not be stat-ed, or the input is not a regular file.
+  failed_to_stat_file,
+
+  /// @brief A file could not be memory mapped.
+  failed_to_map_file,
+
+  /// @brief Output file could not be resized to the length of the output.
+  failed_to_resize_file,
+
+  /// @brief Input and output paths refer to the same file (e.g. a hard link of it), which would be overwritten while it's being read. Nothing is written.
+  same_input_and_output_file,
+
+  /// @brief Decrypted and verified temporary file could not be renamed onto the output path. It's removed.
+  failed_to_replace_file,
+};
+
+/**
+ * @brief Parsed fixed header of an encrypted object.
+ */
+struct ascon_aead128_file_header_t
+{
+  std::array<uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  uint32_t segment_byte_len = 0;
+  uint64_t plaintext_byte_len = 0;
+};
+
+// Returns byte length of the header i.e. fixed header followed by tags of all segments, for plaintext of given length.
+[[nodiscard]]
+forceinline constexpr size_t
+header_byte_len(const size_t plaintext_byte_len, const size_t segment_byte_len)
+{
+  return FIXED_HEADER_BYTE_LEN + ascon_aead128_stream::segment_count(plaintext_byte_len, segment_byte_len) * TAG_BYTE_LEN;
+}
+
+// Returns byte length of the encrypted object, for plaintext of given length.
+[[nodiscard]]
+forceinline constexpr size_t
+encrypted_byte_len(const size_t plaintext_byte_len, const size_t segment_byte_len)
+{
+  return header_byte_len(plaintext_byte_len, segment_byte_len) + plaintext_byte_len;
+}
+
+// Serializes fixed header.
+forceinline constexpr void
+write_fixed_header(const ascon_aead128_file_header_t& header, std::span<uint8_t, FIXED_HEADER_BYTE_LEN> bytes)
+{
+  bytes[0] = FORMAT_VERSION;
+  std::copy(header.nonce_prefix.begin(), header.nonce_prefix.end(), bytes.begin() + 1);
+
+  constexpr size_t seg_len_off = 1 + NONCE_PREFIX_BYTE_LEN;
+  bytes[seg_len_off + 0] = static_cast<uint8_t>(header.segment_byte_len >> 0);
+  bytes[seg_len_off + 1] = static_cast<uint8_t>(header.segment_byte_len >> 8);
+  bytes[seg_len_off + 2] = static_cast<uint8_t>(header.segment_byte_len >> 16);
+  bytes[seg_len_off + 3] = static_cast<uint8_t>(header.segment_byte_len >> 24);
+
+  ascon_common_utils::to_le_bytes(header.plaintext_byte_len, bytes.template last<sizeof(uint64_t)>());
+}
+
+/**
+ * @brief Parses fixed header of an encrypted object and checks that the object is of the length, the header says it should be.
+ *
+ * @param encrypted Whole encrypted object.
+ * @param header Parsed fixed header.
+ * @return `parsed_header`, if the header is well-formed, otherwise `malformed_header`.
+ */
+[[nodiscard]]
+forceinline constexpr ascon_aead128_file_status_t
+parse_header(std::span<const uint8_t> encrypted, ascon_aead128_file_header_t& header)
+{
+  if ((encrypted.size() < FIXED_HEADER_BYTE_LEN) || (encrypted[0] != FORMAT_VERSION)) {
+    return ascon_aead128_file_status_t::malformed_header;
+  }
+
+  std::copy_n(encrypted.begin() + 1, NONCE_PREFIX_BYTE_LEN, header.nonce_prefix.begin());
+
+  constexpr size_t seg_len_off = 1 + NONCE_PREFIX_BYTE_LEN;
+  header.segment_byte_len = (static_cast<uint32_t>(encrypted[seg_len_off + 3]) << 24) | (static_cast<uint32_t>(encrypted[seg_len_off + 2]) << 16) |
+                            (static_cast<uint32_t>(encrypted[seg_len_off + 1]) << 8) | static_cast<uint32_t>(encrypted[seg_len_off + 0]);
+  header.plaintext_byte_len = ascon_common_utils::from_le_bytes(encrypted.subspan<seg_len_off + sizeof(uint32_t), sizeof(uint64_t)>());
+
+  // Plaintext can't be longer than the encrypted object, which also keeps following length computation from overflowing.
+  if ((header.segment_byte_len == 0) || (header.plaintext_byte_len > encrypted.size())) {
+    return ascon_aead128_file_status_t::malformed_header;
+  }
+
+  const size_t pt_byte_len = static_cast<size_t>(header.plaintext_byte_len);
+  if (encrypted_byte_len(pt_byte_len, header.segment_byte_len) != encrypted.size()) {
+    return ascon_aead128_file_status_t::malformed_header;
+  }
+
+  return ascon_aead128_file_status_t::parsed_header;
+}
+
+// Returns associated data, each segment is authenticated with i.e. fixed header, followed by caller supplied associated data.
+[[nodiscard]]
+inline std::vector<uint8_t>
+segment_associated_data(std::span<const uint8_t, FIXED_HEADER_BYTE_LEN> fixed_header, std::span<const uint8_t> associated_data)
+{
+  std::vector<uint8_t> segment_ad(fixed_header.size() + associated_data.size());
+
+  std::copy(fixed_header.begin(), fixed_header.end(), segment_ad.begin());
+  std::copy(associated_data.begin(), associated_data.end(), segment_ad.begin() + FIXED_HEADER_BYTE_LEN);
+
+  return segment_ad;
+}
+
+/**
+ * @brief Encrypts whole plaintext into a preallocated output, laid out as header followed by ciphertext. Segments are encrypted, LANES at a time, using the
+ * multi-lane Ascon permutation, on all threads of the pool, each one writing its ciphertext and tag directly to where they belong in the output.
+ *
+ * @param pool Thread pool, to run on.
+ * @param key The 128-bit encryption key.
+ * @param nonce_prefix The 88-bit nonce prefix (must be unique for each object encrypted with the same key).
+ * @param associated_data Associated data, to be authenticated, but not stored in the output.
+ * @param plaintext Whole plaintext.
+ * @param encrypted Encrypted object, to be produced. Must be `encrypted_byte_len(plaintext.size(), segment_byte_len)` -bytes.
+ * @param segment_byte_len Length of plaintext segments.
+ * @return An `ascon_aead128_file_status_t` indicating the status of the operation.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+inline ascon_aead128_file_status_t
+encrypt(ascon_parallel::thread_pool_t& pool,
+        std::span<const uint8_t, KEY_BYTE_LEN> key,
+        std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+        std::span<const uint8_t> associated_data,
+        std::span<const uint8_t> plaintext,
+        std::span<uint8_t> encrypted,
+        const size_t segment_byte_len = DEFAULT_SEGMENT_BYTE_LEN)
+{
+  if ((segment_byte_len == 0) || (segment_byte_len > std::numeric_limits<uint32_t>::max()) ||
+      (encrypted.size() != encrypted_byte_len(plaintext.size(), segment_byte_len))) {
+    return ascon_aead128_file_status_t::buffer_length_mismatch;
+  }
+  if (ascon_aead128_stream::segment_count(plaintext.size(), segment_byte_len) > ascon_aead128_stream::MAX_SEGMENT_COUNT) {
+    return ascon_aead128_file_status_t::too_many_segments;
+  }
+
+  ascon_aead128_file_header_t header{};
+  std::copy(nonce_prefix.begin(), nonce_prefix.end(), header.nonce_prefix.begin());
+  header.segment_byte_len = static_cast<uint32_t>(segment_byte_len);
+  header.plaintext_byte_len = plaintext.size();
+
+  auto fixed_header = encrypted.first<FIXED_HEADER_BYTE_LEN>();
+  write_fixed_header(header, fixed_header);
+
+  const auto segment_ad = segment_associated_data(fixed_header, associated_data);
+
+  const size_t hdr_byte_len = header_byte_len(plaintext.size(), segment_byte_len);
+  const auto tags = encrypted.subspan(FIXED_HEADER_BYTE_LEN, hdr_byte_len - FIXED_HEADER_BYTE_LEN);
+  const auto ciphertext = encrypted.subspan(hdr_byte_len);
+
+  (void)ascon_aead128_stream::encrypt_detached<LANES>(pool, key, nonce_prefix, segment_ad, plaintext, ciphertext, tags, segment_byte_len);
+  return ascon_aead128_file_status_t::encrypted;
+}
+
+/**
+ * @brief Decrypts whole encrypted object, as produced by `encrypt`, verifying tags of all segments. Segments are decrypted, LANES at a time, using the
+ * multi-lane Ascon permutation, on all threads of the pool. If tag of any segment doesn't match, whole plaintext is zeroed.
+ *
+ * @param pool Thread pool, to run on.
+ * @param key The 128-bit encryption key.
+ * @param associated_data Associated data, which was authenticated during encryption.
+ * @param encrypted Whole encrypted object.
+ * @param plaintext Whole plaintext, to be produced. Must be of length, the header says - see `parse_header`.
+ * @return An `ascon_aead128_file_status_t` indicating the status of the operation.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+inline ascon_aead128_file_status_t
+decrypt(ascon_parallel::thread_pool_t& pool,
+        std::span<const uint8_t, KEY_BYTE_LEN> key,
+        std::span<const uint8_t> associated_data,
+        std::span<const uint8_t> encrypted,
+        std::span<uint8_t> plaintext)
+{
+  ascon_aead128_file_header_t header{};
+  if (parse_header(encrypted, header) != ascon_aead128_file_status_t::parsed_header) {
+    return ascon_aead128_file_status_t::malformed_header;
+  }
+  if (plaintext.size() != header.plaintext_byte_len) {
+    return ascon_aead128_file_status_t::buffer_length_mismatch;
+  }
+  if (ascon_aead128_stream::segment_count(plaintext.size(), header.segment_byte_len) > ascon_aead128_stream::MAX_SEGMENT_COUNT) {
+    return ascon_aead128_file_status_t::too_many_segments;
+  }
+
+  const auto segment_ad = segment_associated_data(encrypted.first<FIXED_HEADER_BYTE_LEN>(), associated_data);
+
+  const size_t hdr_byte_len = header_byte_len(plaintext.size(), header.segment_byte_len);
+  const auto tags = encrypted.subspan(FIXED_HEADER_BYTE_LEN, hdr_byte_len - FIXED_HEADER_BYTE_LEN);
+  const auto ciphertext = encrypted.subspan(hdr_byte_len);
+
+  const auto status =
+    ascon_aead128_stream::decrypt_detached<LANES>(pool, key, header.nonce_prefix, segment_ad, ciphertext, tags, plaintext, header.segment_byte_len);
+  return status == ascon_aead128_stream::ascon_aead128_stream_status_t::decrypted_stream ? ascon_aead128_file_status_t::decrypted
+                                                                                           : ascon_aead128_file_status_t::decryption_failure_due_to_tag_mismatch;
+}
+
+// Opens a regular file for reading and maps it as a whole.
+[[nodiscard]]
+inline ascon_aead128_file_status_t
+map_input_file(const char* path, ascon_file::mapped_file_t& file)
+{
+  if (!file.open(path, O_RDONLY)) {
+    return ascon_aead128_file_status_t::failed_to_open_file;
+  }
+
+  struct stat st{};
+  if ((::fstat(file.fd, &st) != 0) || !S_ISREG(st.st_mode)) {
+    return ascon_aead128_file_status_t::failed_to_stat_file;
+  }
+  if (!file.map(static_cast<size_t>(st.st_size), PROT_READ)) {
+    return ascon_aead128_file_status_t::failed_to_map_file;
+  }
+
+  ::madvise(file.base, file.len, MADV_SEQUENTIAL);
+  return ascon_aead128_file_status_t::mapped_file;
+}
+
+// Creates (or truncates) output file, preallocates it to `byte_len` -bytes and maps it, writable, as a whole. Output file is truncated only after making sure
+// that it's not the already open input file, which is still to be read.
+[[nodiscard]]
+inline ascon_aead128_file_status_t
+map_output_file(const char* path, const size_t byte_len, const ascon_file::mapped_file_t& in_file, ascon_file::mapped_file_t& file)
+{
+  if (!file.open(path, O_RDWR | O_CREAT)) {
+    return ascon_aead128_file_status_t::failed_to_open_file;
+  }
+
+  struct stat in_st{};
+  struct stat out_st{};
+  if ((::fstat(in_file.fd, &in_st) != 0) || (::fstat(file.fd, &out_st) != 0)) {
+    return ascon_aead128_file_status_t::failed_to_stat_file;
+  }
+  if ((in_st.st_dev == out_st.st_dev) && (in_st.st_ino == out_st.st_ino)) {
+    return ascon_aead128_file_status_t::same_input_and_output_file;
+  }
+
+  if ((::ftruncate(file.fd, 0) != 0) || (::ftruncate(file.fd, static_cast<off_t>(byte_len)) != 0)) {
+    return ascon_aead128_file_status_t::failed_to_resize_file;
+  }
+  if (!file.map(byte_len, PROT_READ | PROT_WRITE)) {
+    return ascon_aead128_file_status_t::failed_to_map_file;
+  }
+
+  return ascon_aead128_file_status_t::mapped_file;
+}
+
+// Checks whether the file at `path`, if it exists, is the already open input file.
+[[nodiscard]]
+inline bool
+is_input_file(const char* path, const ascon_file::mapped_file_t& in_file)
+{
+  struct stat in_st{};
+  struct stat out_st{};
+  if ((::fstat(in_file.fd, &in_st) != 0) || (::stat(path, &out_st) != 0)) {
+    return false;
+  }
+
+  return (in_st.st_dev == out_st.st_dev) && (in_st.st_ino == out_st.st_ino);
+}
+
+// Creates a new temporary file, next to `path`, so that it can later be renamed onto it, preallocates it to `byte_len` -bytes and maps it, writable, as a
+// whole. While it's being filled, it's accessible only by its owner, while permission bits it was created with (0644, minus umask) are returned in `mode`.
+[[nodiscard]]
+inline ascon_aead128_file_status_t
+map_temp_output_file(const char* path, const size_t byte_len, std::string& temp_path, mode_t& mode, ascon_file::mapped_file_t& file)
+{
+  static std::atomic<uint64_t> temp_file_counter{ 0 };
+
+  while (true) {
+    temp_path = std::string(path) + ".tmp-" + std::to_string(::getpid()) + "-" + std::to_string(temp_file_counter.fetch_add(1, std::memory_order_relaxed));
+    if (file.open(temp_path.c_str(), O_RDWR | O_CREAT | O_EXCL)) {
+      break;
+    }
+    if (errno != EEXIST) {
+      temp_path.clear();
+      return ascon_aead128_file_status_t::failed_to_open_file;
+    }
+  }
+
+  struct stat st{};
+  if (::fstat(file.fd, &st) != 0) {
+    return ascon_aead128_file_status_t::failed_to_stat_file;
+  }
+  mode = st.st_mode & 0777;
+
+  if (::fchmod(file.fd, 0600) != 0) {
+    return ascon_aead128_file_status_t::failed_to_stat_file;
+  }
+  if (::ftruncate(file.fd, static_cast<off_t>(byte_len)) != 0) {
+    return ascon_aead128_file_status_t::failed_to_resize_file;
+  }
+  if (!file.map(byte_len, PROT_READ | PROT_WRITE)) {
+    return ascon_aead128_file_status_t::failed_to_map_file;
+  }
+
+  return ascon_aead128_file_status_t::mapped_file;
+}
+
+/**
+ * @brief Encrypts a regular file into another one, see `encrypt`. Input is memory mapped, while output is preallocated to its final length and memory mapped,
+ * so that segments are encrypted, in parallel, straight from the page cache, into the page cache, without any intermediate copy.
+ *
+ * @param pool Thread pool, to run on.
+ * @param key The 128-bit encryption key.
+ * @param nonce_prefix The 88-bit nonce prefix (must be unique for each object encrypted with the same key).
+ * @param associated_data Associated data, to be authenticated, but not stored in the output.
+ * @param in_path Path to the plaintext file.
+ * @param out_path Path to the encrypted file, to be created (or overwritten). Must not refer to the input file.
+ * @param segment_byte_len Length of plaintext segments.
+ * @return An `ascon_aead128_file_status_t` indicating the status of the operation.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+inline ascon_aead128_file_status_t
+encrypt_file(ascon_parallel::thread_pool_t& pool,
+             std::span<const uint8_t, KEY_BYTE_LEN> key,
+             std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+             std::span<const uint8_t> associated_data,
+             const char* in_path,
+             const char* out_path,
+             const size_t segment_byte_len = DEFAULT_SEGMENT_BYTE_LEN)
+{
+  ascon_file::mapped_file_t in_file;
+  if (const auto status = map_input_file(in_path, in_file); status != ascon_aead128_file_status_t::mapped_file) {
+    return status;
+  }
+
+  if ((segment_byte_len == 0) || (segment_byte_len > std::numeric_limits<uint32_t>::max())) {
+    return ascon_aead128_file_status_t::buffer_length_mismatch;
+  }
+  if (ascon_aead128_stream::segment_count(in_file.len, segment_byte_len) > ascon_aead128_stream::MAX_SEGMENT_COUNT) {
+    return ascon_aead128_file_status_t::too_many_segments;
+  }
+
+  ascon_file::mapped_file_t out_file;
+  if (const auto status = map_output_file(out_path, encrypted_byte_len(in_file.len, segment_byte_len), in_file, out_file);
+      status != ascon_aead128_file_status_t::mapped_file) {
+    return status;
+  }
+
+  return encrypt<LANES>(pool, key, nonce_prefix, associated_data, in_file.bytes(), out_file.bytes(), segment_byte_len);
+}
+
+/**
+ * @brief Decrypts an encrypted regular file, as produced by `encrypt_file`, into another one, see `decrypt`. Plaintext is written into a temporary file, in
+ * the directory of the output file, which is renamed onto the output path only after tags of all segments match. Otherwise the temporary file is removed and
+ * the output path is left untouched, so that unverified plaintext is never published.
+ *
+ * @param pool Thread pool, to run on.
+ * @param key The 128-bit encryption key.
+ * @param associated_data Associated data, which was authenticated during encryption.
+ * @param in_path Path to the encrypted file.
+ * @param out_path Path to the plaintext file, to be created (or overwritten). Must not refer to the input file.
+ * @return An `ascon_aead128_file_status_t` indicating the status of the operation.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+inline ascon_aead128_file_status_t
+decrypt_file(ascon_parallel::thread_pool_t& pool,
+             std::span<const uint8_t, KEY_BYTE_LEN> key,
+             std::span<const uint8_t> associated_data,
+             const char* in_path,
+             const char* out_path)
+{
+  ascon_file::mapped_file_t in_file;
+  if (const auto status = map_input_file(in_path, in_file); status != ascon_aead128_file_status_t::mapped_file) {
+    return status;
+  }
+
+  ascon_aead128_file_header_t header{};
+  if (parse_header(in_file.bytes(), header) != ascon_aead128_file_status_t::parsed_header) {
+    return ascon_aead128_file_status_t::malformed_header;
+  }
+
+  if (is_input_file(out_path, in_file)) {
+    return ascon_aead128_file_status_t::same_input_and_output_file;
+  }
+
+  std::string temp_path;
+  mode_t mode = 0;
+  ascon_file::mapped_file_t out_file;
+
+  auto status = map_temp_output_file(out_path, static_cast<size_t>(header.plaintext_byte_len), temp_path, mode, out_file);
+  if (status == ascon_aead128_file_status_t::mapped_file) {
+    status = decrypt<LANES>(pool, key, associated_data, in_file.bytes(), out_file.bytes());
+    out_file.unmap();
+  }
+
+  if (status == ascon_aead128_file_status_t::decrypted) {
+    if ((::fchmod(out_file.fd, mode) != 0) || (::rename(temp_path.c_str(), out_path) != 0)) {
+      status = ascon_aead128_file_status_t::failed_to_replace_file;
+    }
+  }
+  if ((status != ascon_aead128_file_status_t::decrypted) && !temp_path.empty()) {
+    ::unlink(temp_path.c_str());
+  }
+
+  return status;
+}
+
+}
@@ -0,0 +1,640 @@
+#pragma once
+#include "ascon/aead/ascon_aead128.hpp"
+#include "ascon/utils/thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Online authenticated encryption of large objects, built on Ascon-AEAD128, following the STREAM construction of Hoang, Reyhanitabar, Rogaway and Vizár
+// (https://eprint.iacr.org/2015/189).
+//
+// Plaintext is split into `segment_byte_len` -bytes segments (last one can be shorter, an empty plaintext makes a single empty segment), each of which is
+// encrypted and authenticated, independently, using Ascon-AEAD128, under nonce
+//
+//   nonce prefix (11 -bytes) || be32(segment index) || last segment flag (1 -byte, 0x01 for last segment, 0x00 otherwise)
+//
+// so that segments can't be reordered, dropped or the stream be truncated, without being detected. Encrypted stream is concatenation of
+// `ciphertext || tag` of all segments. As each segment carries its own tag, it can be verified and released as soon as it's decrypted, keeping memory use
+// bounded by segment length, and any segment can be decrypted without touching the others. Segments being independent, they are also processed in parallel,
+// LANES at a time using the multi-lane Ascon permutation, on multiple threads.
+namespace ascon_aead128_stream {
+
+static constexpr size_t KEY_BYTE_LEN = ascon_aead128::KEY_BYTE_LEN;
+static constexpr size_t TAG_BYTE_LEN = ascon_aead128::TAG_BYTE_LEN;
+static constexpr size_t NONCE_PREFIX_BYTE_LEN = 11;
+static constexpr size_t DEFAULT_SEGMENT_BYTE_LEN = 64 * 1'024;
+
+// Segment index is encoded as a 32 -bit integer, in the nonce.
+static constexpr uint64_t MAX_SEGMENT_COUNT = uint64_t{ 1 } << 32;
+
+static_assert(NONCE_PREFIX_BYTE_LEN + sizeof(uint32_t) + 1 == ascon_aead128::NONCE_BYTE_LEN, "Segment nonce must be of same length as Ascon-AEAD128 nonce.");
+
+/// @brief Enumeration representing the status of streaming Ascon-AEAD128 operations.
+enum class ascon_aead128_stream_status_t : uint8_t
+{
+  /// @brief A segment was successfully encrypted.
+  encrypted_segment = 0x01,
+
+  /// @brief A segment was successfully decrypted and its tag matched, so its plaintext can be released.
+  decrypted_segment,
+
+  /// @brief Whole stream was successfully encrypted.
+  encrypted_stream,
+
+  /// @brief Whole stream was successfully decrypted and tags of all segments matched.
+  decrypted_stream,
+
+  /// @brief Tag of a segment didn't match - the stream is either tampered with or truncated. Plaintext, being produced, is zeroed.
+  decryption_failure_due_to_tag_mismatch,
+
+  /// @brief Last segment was already processed, stream can't be extended any further.
+  stream_already_finalized,
+
+  /// @brief Stream would have more than `MAX_SEGMENT_COUNT` segments.
+  too_many_segments,
+
+  /// @brief Segment length is zero, or length of a segment, the output buffer or the encrypted stream is not what it should be.
+  buffer_length_mismatch,
+
+  /// @brief Requested segment index is not less than the number of segments in the encrypted stream.
+  segment_index_out_of_range,
+};
+
+// Computes Ascon-AEAD128 nonce of a segment, from the nonce prefix, the segment index and whether it's the last segment of the stream.
+forceinline constexpr void
+compute_segment_nonce(std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+                      const uint32_t segment_idx,
+                      const bool is_last_segment,
+                      std::span<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce)
+{
+  std::copy(nonce_prefix.begin(), nonce_prefix.end(), nonce.begin());
+
+  nonce[NONCE_PREFIX_BYTE_LEN + 0] = static_cast<uint8_t>(segment_idx >> 24);
+  nonce[NONCE_PREFIX_BYTE_LEN + 1] = static_cast<uint8_t>(segment_idx >> 16);
+  nonce[NONCE_PREFIX_BYTE_LEN + 2] = static_cast<uint8_t>(segment_idx >> 8);
+  nonce[NONCE_PREFIX_BYTE_LEN + 3] = static_cast<uint8_t>(segment_idx >> 0);
+  nonce[NONCE_PREFIX_BYTE_LEN + 4] = static_cast<uint8_t>(is_last_segment);
+}
+
+// Returns number of segments, plaintext of given length is split into. An empty plaintext makes a single empty segment.
+[[nodiscard]]
+forceinline constexpr size_t
+segment_count(const size_t plaintext_byte_len, const size_t segment_byte_len)
+{
+  return std::max<size_t>((plaintext_byte_len + (segment_byte_len - 1)) / segment_byte_len, 1);
+}
+
+// Returns byte length of the encrypted stream, for plaintext of given length.
+[[nodiscard]]
+forceinline constexpr size_t
+encrypted_stream_byte_len(const size_t plaintext_byte_len, const size_t segment_byte_len)
+{
+  return plaintext_byte_len + segment_count(plaintext_byte_len, segment_byte_len) * TAG_BYTE_LEN;
+}
+
+// Returns byte length of plaintext, recovered from an encrypted stream of given length, or zero, if no plaintext can produce an encrypted stream of that
+// length.
+[[nodiscard]]
+forceinline constexpr size_t
+plaintext_byte_len(const size_t stream_byte_len, const size_t segment_byte_len)
+{
+  const size_t encrypted_segment_byte_len = segment_byte_len + TAG_BYTE_LEN;
+
+  const size_t num_full_segments = stream_byte_len / encrypted_segment_byte_len;
+  const size_t tail_byte_len = stream_byte_len % encrypted_segment_byte_len;
+
+  if (tail_byte_len == 0) {
+    return num_full_segments * segment_byte_len;
+  }
+  if (tail_byte_len < TAG_BYTE_LEN) {
+    return 0;
+  }
+
+  return num_full_segments * segment_byte_len + (tail_byte_len - TAG_BYTE_LEN);
+}
+
+// Checks whether an encrypted stream of given length can be produced by some plaintext, which is split into segments of given length.
+[[nodiscard]]
+forceinline constexpr bool
+is_valid_encrypted_stream_byte_len(const size_t stream_byte_len, const size_t segment_byte_len)
+{
+  if ((segment_byte_len == 0) || (stream_byte_len < TAG_BYTE_LEN)) {
+    return false;
+  }
+
+  const size_t pt_byte_len = plaintext_byte_len(stream_byte_len, segment_byte_len);
+  return encrypted_stream_byte_len(pt_byte_len, segment_byte_len) == stream_byte_len;
+}
+
+/**
+ * @brief Online streaming encryptor, producing one encrypted segment at a time, so that memory use stays bounded by segment length. Segments must be fed in
+ * order, all but the last one being exactly `segment_byte_len` -bytes.
+ */
+struct ascon_aead128_stream_encryptor_t
+{
+private:
+  ascon_aead128::ascon_aead128_key_t key;
+  std::array<uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  size_t segment_byte_len = 0;
+  uint64_t next_segment_idx = 0;
+  alignas(4) bool finished = false;
+
+public:
+  // Constructor(s)/ Destructor(s)
+  forceinline constexpr ascon_aead128_stream_encryptor_t(std::span<const uint8_t, KEY_BYTE_LEN> key,
+                                                         std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+                                                         const size_t segment_byte_len = DEFAULT_SEGMENT_BYTE_LEN)
+    : key(key)
+    , segment_byte_len(segment_byte_len)
+  {
+    std::copy(nonce_prefix.begin(), nonce_prefix.end(), this->nonce_prefix.begin());
+  }
+
+  /**
+   * @brief Encrypts next segment of the stream, writing its ciphertext, followed by tag.
+   *
+   * @param associated_data Associated data, to be authenticated along with this segment. Pass the same one for all segments, to bind it to whole stream.
+   * @param plaintext Plaintext of the segment. Must be `segment_byte_len` -bytes, unless it's the last segment, which can be shorter.
+   * @param ciphertext_and_tag Ciphertext, followed by the tag, to be produced. Must be `plaintext.size() + TAG_BYTE_LEN` -bytes.
+   * @param is_last_segment Whether it's the last segment of the stream.
+   * @return An `ascon_aead128_stream_status_t` indicating the status of the operation:
+   *   - `encrypted_segment`: Segment was successfully encrypted.
+   *   - `stream_already_finalized`: Last segment was already encrypted.
+   *   - `too_many_segments`: Stream already has `MAX_SEGMENT_COUNT` segments.
+   *   - `buffer_length_mismatch`: Segment length, or length of output buffer, is not what it should be. Nothing is written.
+   */
+  [[nodiscard]]
+  forceinline constexpr ascon_aead128_stream_status_t encrypt_segment(std::span<const uint8_t> associated_data,
+                                                                      std::span<const uint8_t> plaintext,
+                                                                      std::span<uint8_t> ciphertext_and_tag,
+                                                                      const bool is_last_segment)
+  {
+    if (finished) {
+      return ascon_aead128_stream_status_t::stream_already_finalized;
+    }
+    if (next_segment_idx == MAX_SEGMENT_COUNT) {
+      return ascon_aead128_stream_status_t::too_many_segments;
+    }
+
+    const bool is_valid_segment_len = is_last_segment ? (plaintext.size() <= segment_byte_len) : (plaintext.size() == segment_byte_len);
+    if ((segment_byte_len == 0) || !is_valid_segment_len || (ciphertext_and_tag.size() != (plaintext.size() + TAG_BYTE_LEN))) {
+      return ascon_aead128_stream_status_t::buffer_length_mismatch;
+    }
+
+    std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+    compute_segment_nonce(nonce_prefix, static_cast<uint32_t>(next_segment_idx), is_last_segment, nonce);
+
+    (void)ascon_aead128::seal(key, nonce, associated_data, plaintext, ciphertext_and_tag);
+
+    next_segment_idx++;
+    finished = is_last_segment;
+
+    return ascon_aead128_stream_status_t::encrypted_segment;
+  }
+};
+
+/**
+ * @brief Online streaming decryptor, consuming one encrypted segment at a time, in order. Plaintext of a segment is released only after its tag is verified,
+ * so a tampered segment is never exposed to the caller. Stream must be considered complete only after a segment is decrypted with `is_last_segment` set -
+ * otherwise it has been truncated.
+ */
+struct ascon_aead128_stream_decryptor_t
+{
+private:
+  ascon_aead128::ascon_aead128_key_t key;
+  std::array<uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  size_t segment_byte_len = 0;
+  uint64_t next_segment_idx = 0;
+  alignas(4) bool finished = false;
+
+public:
+  // Constructor(s)/ Destructor(s)
+  forceinline constexpr ascon_aead128_stream_decryptor_t(std::span<const uint8_t, KEY_BYTE_LEN> key,
+                                                         std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+                                                         const size_t segment_byte_len = DEFAULT_SEGMENT_BYTE_LEN)
+    : key(key)
+    , segment_byte_len(segment_byte_len)
+  {
+    std::copy(nonce_prefix.begin(), nonce_prefix.end(), this->nonce_prefix.begin());
+  }
+
+  /**
+   * @brief Decrypts next segment of the stream and verifies its tag.
+   *
+   * @param associated_data Associated data, which was authenticated along with this segment.
+   * @param ciphertext_and_tag Ciphertext of the segment, followed by its tag.
+   * @param plaintext Plaintext, to be produced. Must be `ciphertext_and_tag.size() - TAG_BYTE_LEN` -bytes.
+   * @param is_last_segment Whether it's the last segment of the stream.
+   * @return An `ascon_aead128_stream_status_t` indicating the status of the operation:
+   *   - `decrypted_segment`: Segment was successfully decrypted and its tag matched, plaintext can be released.
+   *   - `decryption_failure_due_to_tag_mismatch`: Tag didn't match, plaintext is zeroed. Decryptor stays at the same segment.
+   *   - `stream_already_finalized`: Last segment was already decrypted.
+   *   - `too_many_segments`: Stream already has `MAX_SEGMENT_COUNT` segments.
+   *   - `buffer_length_mismatch`: Segment length, or length of output buffer, is not what it should be. Nothing is written.
+   */
+  [[nodiscard]]
+  forceinline constexpr ascon_aead128_stream_status_t decrypt_segment(std::span<const uint8_t> associated_data,
+                                                                      std::span<const uint8_t> ciphertext_and_tag,
+                                                                      std::span<uint8_t> plaintext,
+                                                                      const bool is_last_segment)
+  {
+    if (finished) {
+      return ascon_aead128_stream_status_t::stream_already_finalized;
+    }
+    if (next_segment_idx == MAX_SEGMENT_COUNT) {
+      return ascon_aead128_stream_status_t::too_many_segments;
+    }
+
+    const bool is_valid_segment_len = is_last_segment ? (plaintext.size() <= segment_byte_len) : (plaintext.size() == segment_byte_len);
+    if ((segment_byte_len == 0) || !is_valid_segment_len || (ciphertext_and_tag.size() != (plaintext.size() + TAG_BYTE_LEN))) {
+      return ascon_aead128_stream_status_t::buffer_length_mismatch;
+    }
+
+    std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+    compute_segment_nonce(nonce_prefix, static_cast<uint32_t>(next_segment_idx), is_last_segment, nonce);
+
+    const auto status = ascon_aead128::open(key, nonce, associated_data, ciphertext_and_tag, plaintext);
+    if (status != ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches) {
+      return ascon_aead128_stream_status_t::decryption_failure_due_to_tag_mismatch;
+    }
+
+    next_segment_idx++;
+    finished = is_last_segment;
+
+    return ascon_aead128_stream_status_t::decrypted_segment;
+  }
+
+  // Returns truth value for whether the last segment of the stream was decrypted i.e. the stream is complete.
+  [[nodiscard]]
+  forceinline constexpr bool is_finalized() const
+  {
+    return finished;
+  }
+};
+
+/**
+ * @brief Decrypts a single segment, at given index, of an encrypted stream, available in full (e.g. memory mapped), without touching any other segment.
+ * Whether it's the last segment is inferred from the length of the encrypted stream.
+ *
+ * @param key The 128-bit encryption key.
+ * @param nonce_prefix The 88-bit nonce prefix, stream was encrypted with.
+ * @param associated_data Associated data, which was authenticated along with each segment.
+ * @param stream Whole encrypted stream.
+ * @param segment_idx Index of the segment to be decrypted.
+ * @param plaintext Plaintext of the segment, to be produced. Must be of same length as that segment's plaintext.
+ * @param segment_byte_len Length of plaintext segments, stream was encrypted with.
+ * @return An `ascon_aead128_stream_status_t` indicating the status of the operation:
+ *   - `decrypted_segment`: Segment was successfully decrypted and its tag matched.
+ *   - `decryption_failure_due_to_tag_mismatch`: Tag didn't match, plaintext is zeroed.
+ *   - `segment_index_out_of_range`: Stream doesn't have a segment at given index.
+ *   - `buffer_length_mismatch`: Length of the stream, or of the output buffer, is not what it should be. Nothing is written.
+ */
+[[nodiscard]]
+forceinline constexpr ascon_aead128_stream_status_t
+decrypt_segment_at(std::span<const uint8_t, KEY_BYTE_LEN> key,
+                   std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+                   std::span<const uint8_t> associated_data,
+                   std::span<const uint8_t> stream,
+                   const size_t segment_idx,
+                   std::span<uint8_t> plaintext,
+                   const size_t segment_byte_len = DEFAULT_SEGMENT_BYTE_LEN)
+{
+  if (!is_valid_encrypted_stream_byte_len(stream.size(), segment_byte_len)) {
+    return ascon_aead128_stream_status_t::buffer_length_mismatch;
+  }
+
+  const size_t pt_byte_len = plaintext_byte_len(stream.size(), segment_byte_len);
+  const size_t num_segments = segment_count(pt_byte_len, segment_byte_len);
+
+  if (segment_idx >= num_segments) {
+    return ascon_aead128_stream_status_t::segment_index_out_of_range;
+  }
+  if (num_segments > MAX_SEGMENT_COUNT) {
+    return ascon_aead128_stream_status_t::too_many_segments;
+  }
+
+  const size_t offset = segment_idx * segment_byte_len;
+  const size_t ct_byte_len = std::min(segment_byte_len, pt_byte_len - offset);
+
+  if (plaintext.size() != ct_byte_len) {
+    return ascon_aead128_stream_status_t::buffer_length_mismatch;
+  }
+
+  const bool is_last_segment = (segment_idx + 1) == num_segments;
+
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  compute_segment_nonce(nonce_prefix, static_cast<uint32_t>(segment_idx), is_last_segment, nonce);
+
+  const auto encrypted_segment = stream.subspan(segment_idx * (segment_byte_len + TAG_BYTE_LEN), ct_byte_len + TAG_BYTE_LEN);
+
+  const auto status = ascon_aead128::open(key, nonce, associated_data, encrypted_segment, plaintext);
+  return status == ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches
+           ? ascon_aead128_stream_status_t::decrypted_segment
+           : ascon_aead128_stream_status_t::decryption_failure_due_to_tag_mismatch;
+}
+
+/**
+ * @brief Encrypts whole plaintext, available in full, as a stream of segments. Segments are encrypted LANES at a time, using the multi-lane Ascon
+ * permutation, on all threads of the pool. Produces same encrypted stream as feeding segments, one by one, to `ascon_aead128_stream_encryptor_t`.
+ *
+ * @param pool Thread pool, to run on.
+ * @param key The 128-bit encryption key.
+ * @param nonce_prefix The 88-bit nonce prefix (must be unique for each stream encrypted with the same key).
+ * @param associated_data Associated data, to be authenticated along with each segment.
+ * @param plaintext Whole plaintext.
+ * @param stream Encrypted stream, to be produced. Must be `encrypted_stream_byte_len(plaintext.size(), segment_byte_len)` -bytes.
+ * @param segment_byte_len Length of plaintext segments.
+ * @return An `ascon_aead128_stream_status_t` indicating the status of the operation:
+ *   - `encrypted_stream`: Whole stream was successfully encrypted.
+ *   - `too_many_segments`: Plaintext would be split into more than `MAX_SEGMENT_COUNT` segments. Nothing is written.
+ *   - `buffer_length_mismatch`: Segment length is zero or length of the output buffer is not what it should be. Nothing is written.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+inline ascon_aead128_stream_status_t
+encrypt(ascon_parallel::thread_pool_t& pool,
+        std::span<const uint8_t, KEY_BYTE_LEN> key,
+        std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+        std::span<const uint8_t> associated_data,
+        std::span<const uint8_t> plaintext,
+        std::span<uint8_t> stream,
+        const size_t segment_byte_len = DEFAULT_SEGMENT_BYTE_LEN)
+{
+  if ((segment_byte_len == 0) || (stream.size() != encrypted_stream_byte_len(plaintext.size(), segment_byte_len))) {
+    return ascon_aead128_stream_status_t::buffer_length_mismatch;
+  }
+
+  const size_t num_segments = segment_count(plaintext.size(), segment_byte_len);
+  if (num_segments > MAX_SEGMENT_COUNT) {
+    return ascon_aead128_stream_status_t::too_many_segments;
+  }
+
+  pool.parallel_for(num_segments, LANES, [&](const size_t begin, const size_t end) {
+    std::array<std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN>, LANES> nonces{};
+
+    std::vector<ascon_aead128::ascon_aead128_encrypt_packet_t> packets;
+    packets.reserve(end - begin);
+
+    for (size_t i = begin; i < end; i++) {
+      const size_t offset = i * segment_byte_len;
+      const size_t pt_byte_len = std::min(segment_byte_len, plaintext.size() - offset);
+      const auto encrypted_segment = stream.subspan(i * (segment_byte_len + TAG_BYTE_LEN), pt_byte_len + TAG_BYTE_LEN);
+
+      compute_segment_nonce(nonce_prefix, static_cast<uint32_t>(i), (i + 1) == num_segments, nonces[i - begin]);
+
+      packets.push_back({
+        .key = key,
+        .nonce = nonces[i - begin],
+        .associated_data = associated_data,
+        .plaintext = plaintext.subspan(offset, pt_byte_len),
+        .ciphertext = encrypted_segment.first(pt_byte_len),
+        .tag = encrypted_segment.last<TAG_BYTE_LEN>(),
+      });
+    }
+
+    // Ciphertext of each packet is carved out to be of same length as its plaintext, so the burst is always processed.
+    (void)ascon_aead128::encrypt_burst<LANES>(packets);
+  });
+
+  return ascon_aead128_stream_status_t::encrypted_stream;
+}
+
+/**
+ * @brief Decrypts whole encrypted stream, available in full, verifying tags of all segments. Segments are decrypted LANES at a time, using the multi-lane
+ * Ascon permutation, on all threads of the pool. If tag of any segment doesn't match, whole plaintext is zeroed.
+ *
+ * @param pool Thread pool, to run on.
+ * @param key The 128-bit encryption key.
+ * @param nonce_prefix The 88-bit nonce prefix, stream was encrypted with.
+ * @param associated_data Associated data, which was authenticated along with each segment.
+ * @param stream Whole encrypted stream.
+ * @param plaintext Whole plaintext, to be produced. Must be `plaintext_byte_len(stream.size(), segment_byte_len)` -bytes.
+ * @param segment_byte_len Length of plaintext segments, stream was encrypted with.
+ * @return An `ascon_aead128_stream_status_t` indicating the status of the operation:
+ *   - `decrypted_stream`: Whole stream was successfully decrypted and tags of all segments matched.
+ *   - `decryption_failure_due_to_tag_mismatch`: Tag of some segment didn't match, plaintext is zeroed.
+ *   - `too_many_segments`: Stream has more than `MAX_SEGMENT_COUNT` segments. Nothing is written.
+ *   - `buffer_length_mismatch`: Length of the stream, or of the output buffer, is not what it should be. Nothing is written.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+inline ascon_aead128_stream_status_t
+decrypt(ascon_parallel::thread_pool_t& pool,
+        std::span<const uint8_t, KEY_BYTE_LEN> key,
+        std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+        std::span<const uint8_t> associated_data,
+        std::span<const uint8_t> stream,
+        std::span<uint8_t> plaintext,
+        const size_t segment_byte_len = DEFAULT_SEGMENT_BYTE_LEN)
+{
+  if (!is_valid_encrypted_stream_byte_len(stream.size(), segment_byte_len) || (plaintext.size() != plaintext_byte_len(stream.size(), segment_byte_len))) {
+    return ascon_aead128_stream_status_t::buffer_length_mismatch;
+  }
+
+  const size_t num_segments = segment_count(plaintext.size(), segment_byte_len);
+  if (num_segments > MAX_SEGMENT_COUNT) {
+    return ascon_aead128_stream_status_t::too_many_segments;
+  }
+
+  std::atomic<bool> is_any_tag_mismatching{ false };
+
+  pool.parallel_for(num_segments, LANES, [&](const size_t begin, const size_t end) {
+    std::array<std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN>, LANES> nonces{};
+    std::array<ascon_aead128::ascon_aead128_status_t, LANES> results{};
+
+    std::vector<ascon_aead128::ascon_aead128_decrypt_packet_t> packets;
+    packets.reserve(end - begin);
+
+    for (size_t i = begin; i < end; i++) {
+      const size_t offset = i * segment_byte_len;
+      const size_t pt_byte_len = std::min(segment_byte_len, plaintext.size() - offset);
+      const auto encrypted_segment = stream.subspan(i * (segment_byte_len + TAG_BYTE_LEN), pt_byte_len + TAG_BYTE_LEN);
+
+      compute_segment_nonce(nonce_prefix, static_cast<uint32_t>(i), (i + 1) == num_segments, nonces[i - begin]);
+
+      packets.push_back({
+        .key = key,
+        .nonce = nonces[i - begin],
+        .associated_data = associated_data,
+        .ciphertext = encrypted_segment.first(pt_byte_len),
+        .plaintext = plaintext.subspan(offset, pt_byte_len),
+        .tag = encrypted_segment.last<TAG_BYTE_LEN>(),
+      });
+    }
+
+    const auto status = ascon_aead128::decrypt_burst<LANES>(packets, std::span(results).first(end - begin));
+    const bool is_all_matching = (status == ascon_aead128::ascon_aead128_status_t::decrypted_burst) &&
+                                 std::all_of(results.begin(), results.begin() + static_cast<std::ptrdiff_t>(end - begin), [](const auto result) {
+                                   return result == ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches;
+                                 });
+
+    if (!is_all_matching) {
+      is_any_tag_mismatching.store(true, std::memory_order_relaxed);
+    }
+  });
+
+  if (is_any_tag_mismatching.load(std::memory_order_relaxed)) {
+    std::fill(plaintext.begin(), plaintext.end(), 0x00);
+    return ascon_aead128_stream_status_t::decryption_failure_due_to_tag_mismatch;
+  }
+
+  return ascon_aead128_stream_status_t::decrypted_stream;
+}
+
+/**
+ * @brief Encrypts whole plaintext, available in full, as a stream of segments, keeping ciphertext and tags apart - ciphertext is written contiguously, of
+ * same length as the plaintext (so that it can be encrypted in-place), while tags of all segments are collected, in segment order, into a separate buffer.
+ * Segments are encrypted LANES at a time, using the multi-lane Ascon permutation, on all threads of the pool. Ciphertext and tags are same as of the
+ * encrypted stream, produced by `encrypt`.
+ *
+ * @param pool Thread pool, to run on.
+ * @param key The 128-bit encryption key.
+ * @param nonce_prefix The 88-bit nonce prefix (must be unique for each stream encrypted with the same key).
+ * @param associated_data Associated data, to be authenticated along with each segment.
+ * @param plaintext Whole plaintext.
+ * @param ciphertext Whole ciphertext, to be produced. Must be of same length as the plaintext, can alias it for in-place encryption.
+ * @param tags Tags of all segments, to be produced. Must be `segment_count(plaintext.size(), segment_byte_len) * TAG_BYTE_LEN` -bytes.
+ * @param segment_byte_len Length of plaintext segments.
+ * @return An `ascon_aead128_stream_status_t` indicating the status of the operation:
+ *   - `encrypted_stream`: Whole stream was successfully encrypted.
+ *   - `too_many_segments`: Plaintext would be split into more than `MAX_SEGMENT_COUNT` segments. Nothing is written.
+ *   - `buffer_length_mismatch`: Segment length is zero or length of an output buffer is not what it should be. Nothing is written.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+inline ascon_aead128_stream_status_t
+encrypt_detached(ascon_parallel::thread_pool_t& pool,
+                 std::span<const uint8_t, KEY_BYTE_LEN> key,
+                 std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+                 std::span<const uint8_t> associated_data,
+                 std::span<const uint8_t> plaintext,
+                 std::span<uint8_t> ciphertext,
+                 std::span<uint8_t> tags,
+                 const size_t segment_byte_len = DEFAULT_SEGMENT_BYTE_LEN)
+{
+  if ((segment_byte_len == 0) || (ciphertext.size() != plaintext.size()) ||
+      (tags.size() != segment_count(plaintext.size(), segment_byte_len) * TAG_BYTE_LEN)) {
+    return ascon_aead128_stream_status_t::buffer_length_mismatch;
+  }
+
+  const size_t num_segments = segment_count(plaintext.size(), segment_byte_len);
+  if (num_segments > MAX_SEGMENT_COUNT) {
+    return ascon_aead128_stream_status_t::too_many_segments;
+  }
+
+  pool.parallel_for(num_segments, LANES, [&](const size_t begin, const size_t end) {
+    std::array<std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN>, LANES> nonces{};
+    std::vector<ascon_aead128::ascon_aead128_encrypt_packet_t> packets;
+    packets.reserve(end - begin);
+
+    for (size_t i = begin; i < end; i++) {
+      const size_t offset = i * segment_byte_len;
+      const size_t pt_byte_len = std::min(segment_byte_len, plaintext.size() - offset);
+
+      compute_segment_nonce(nonce_prefix, static_cast<uint32_t>(i), (i + 1) == num_segments, nonces[i - begin]);
+
+      packets.push_back({
+        .key = key,
+        .nonce = nonces[i - begin],
+        .associated_data = associated_data,
+        .plaintext = plaintext.subspan(offset, pt_byte_len),
+        .ciphertext = ciphertext.subspan(offset, pt_byte_len),
+        .tag = tags.subspan(i * TAG_BYTE_LEN).first<TAG_BYTE_LEN>(),
+      });
+    }
+
+    // Ciphertext of each packet is carved out to be of same length as its plaintext, so the burst is always processed.
+    (void)ascon_aead128::encrypt_burst<LANES>(packets);
+  });
+
+  return ascon_aead128_stream_status_t::encrypted_stream;
+}
+
+/**
+ * @brief Decrypts whole ciphertext, available in full, with tags of its segments kept apart, as produced by `encrypt_detached`, verifying tags of all
+ * segments. Segments are decrypted LANES at a time, using the multi-lane Ascon permutation, on all threads of the pool. If tag of any segment doesn't match,
+ * whole plaintext is zeroed.
+ *
+ * @param pool Thread pool, to run on.
+ * @param key The 128-bit encryption key.
+ * @param nonce_prefix The 88-bit nonce prefix, stream was encrypted with.
+ * @param associated_data Associated data, which was authenticated along with each segment.
+ * @param ciphertext Whole ciphertext.
+ * @param tags Tags of all segments. Must be `segment_count(ciphertext.size(), segment_byte_len) * TAG_BYTE_LEN` -bytes.
+ * @param plaintext Whole plaintext, to be produced. Must be of same length as the ciphertext, can alias it for in-place decryption.
+ * @param segment_byte_len Length of plaintext segments, stream was encrypted with.
+ * @return An `ascon_aead128_stream_status_t` indicating the status of the operation:
+ *   - `decrypted_stream`: Whole stream was successfully decrypted and tags of all segments matched.
+ *   - `decryption_failure_due_to_tag_mismatch`: Tag of some segment didn't match, plaintext is zeroed.
+ *   - `too_many_segments`: Stream has more than `MAX_SEGMENT_COUNT` segments. Nothing is written.
+ *   - `buffer_length_mismatch`: Segment length is zero or length of some buffer is not what it should be. Nothing is written.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+inline ascon_aead128_stream_status_t
+decrypt_detached(ascon_parallel::thread_pool_t& pool,
+                 std::span<const uint8_t, KEY_BYTE_LEN> key,
+                 std::span<const uint8_t, NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+                 std::span<const uint8_t> associated_data,
+                 std::span<const uint8_t> ciphertext,
+                 std::span<const uint8_t> tags,
+                 std::span<uint8_t> plaintext,
+                 const size_t segment_byte_len = DEFAULT_SEGMENT_BYTE_LEN)
+{
+  if ((segment_byte_len == 0) || (plaintext.size() != ciphertext.size()) ||
+      (tags.size() != segment_count(ciphertext.size(), segment_byte_len) * TAG_BYTE_LEN)) {
+    return ascon_aead128_stream_status_t::buffer_length_mismatch;
+  }
+
+  const size_t num_segments = segment_count(ciphertext.size(), segment_byte_len);
+  if (num_segments > MAX_SEGMENT_COUNT) {
+    return ascon_aead128_stream_status_t::too_many_segments;
+  }
+
+  std::atomic<bool> is_any_tag_mismatching{ false };
+
+  pool.parallel_for(num_segments, LANES, [&](const size_t begin, const size_t end) {
+    std::array<std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN>, LANES> nonces{};
+    std::vector<ascon_aead128::ascon_aead128_decrypt_packet_t> packets;
+    packets.reserve(end - begin);
+    std::array<ascon_aead128::ascon_aead128_status_t, LANES> results{};
+
+    for (size_t i = begin; i < end; i++) {
+      const size_t offset = i * segment_byte_len;
+      const size_t ct_byte_len = std::min(segment_byte_len, ciphertext.size() - offset);
+
+      compute_segment_nonce(nonce_prefix, static_cast<uint32_t>(i), (i + 1) == num_segments, nonces[i - begin]);
+
+      packets.push_back({
+        .key = key,
+        .nonce = nonces[i - begin],
+        .associated_data = associated_data,
+        .ciphertext = ciphertext.subspan(offset, ct_byte_len),
+        .plaintext = plaintext.subspan(offset, ct_byte_len),
+        .tag = tags.subspan(i * TAG_BYTE_LEN).first<TAG_BYTE_LEN>(),
+      });
+    }
+
+    const auto status = ascon_aead128::decrypt_burst<LANES>(packets, std::span(results).first(end - begin));
+    const bool is_all_matching = (status == ascon_aead128::ascon_aead128_status_t::decrypted_burst) &&
+                                 std::all_of(results.begin(), results.begin() + static_cast<std::ptrdiff_t>(end - begin), [](const auto result) {
+                                   return result == ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches;
+                                 });
+
+    if (!is_all_matching) {
+      is_any_tag_mismatching.store(true, std::memory_order_relaxed);
+    }
+  });
+
+  if (is_any_tag_mismatching.load(std::memory_order_relaxed)) {
+    std::fill(plaintext.begin(), plaintext.end(), 0x00);
+    return ascon_aead128_stream_status_t::decryption_failure_due_to_tag_mismatch;
+  }
+
+  return ascon_aead128_stream_status_t::decrypted_stream;
+}
+
+}
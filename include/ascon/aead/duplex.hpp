@@ -2,6 +2,7 @@
 #include "ascon/permutation/ascon.hpp"
 #include "ascon/utils/common.hpp"
 #include "ascon/utils/force_inline.hpp"
+#include "ascon/utils/instrumentation.hpp"
 #include <algorithm>
 #include <array>
 #include <limits>
@@ -22,30 +23,51 @@ static constexpr size_t KEY_BYTE_LEN = BIT_SECURITY_LEVEL / std::numeric_limits<
 static constexpr size_t NONCE_BYTE_LEN = BIT_SECURITY_LEVEL / std::numeric_limits<uint8_t>::digits;
 static constexpr size_t TAG_BYTE_LEN = BIT_SECURITY_LEVEL / std::numeric_limits<uint8_t>::digits;
 
+static constexpr uint64_t INITIAL_VALUE =
+  ascon_common_utils::compute_iv(UNIQUE_ALGORITHM_ID, ASCON_PERM_NUM_ROUNDS_A, ASCON_PERM_NUM_ROUNDS_B, TAG_BYTE_LEN * 8, RATE_BYTES);
+
 /**
- * @brief Initializes the Ascon permutation state with the given key and nonce.
+ * @brief Initializes the Ascon permutation state with the given key, already parsed as two 64 -bit words, and nonce.
  * See point 1 of section 4.1.1 in Ascon standard @ https://doi.org/10.6028/NIST.SP.800-232.
  *
  * @param state Ascon permutation state.
- * @param key Encryption key.
+ * @param key_first First 64 -bit word of encryption key, interpreted as little-endian.
+ * @param key_last Last 64 -bit word of encryption key, interpreted as little-endian.
  * @param nonce Nonce - don't repeat it, for the same key !
  */
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-initialize(ascon_perm::ascon_perm_t& state, std::span<const uint8_t, KEY_BYTE_LEN> key, std::span<const uint8_t, NONCE_BYTE_LEN> nonce)
+initialize(perm_t& state, const uint64_t key_first, const uint64_t key_last, std::span<const uint8_t, NONCE_BYTE_LEN> nonce)
 {
-  const auto key_first = ascon_common_utils::from_le_bytes(key.first<8>());
-  const auto key_last = ascon_common_utils::from_le_bytes(key.last<8>());
+  // Key words are mixed into the state twice, so they are converted to native state representation only once.
+  const uint64_t native_key_first = perm_t::to_native(key_first);
+  const uint64_t native_key_last = perm_t::to_native(key_last);
 
-  state[0] = ascon_common_utils::compute_iv(UNIQUE_ALGORITHM_ID, ASCON_PERM_NUM_ROUNDS_A, ASCON_PERM_NUM_ROUNDS_B, TAG_BYTE_LEN * 8, RATE_BYTES);
-  state[1] = key_first;
-  state[2] = key_last;
-  state[3] = ascon_common_utils::from_le_bytes(nonce.first<8>());
-  state[4] = ascon_common_utils::from_le_bytes(nonce.last<8>());
+  state.set_word(0, INITIAL_VALUE);
+  state.set_native_word(1, native_key_first);
+  state.set_native_word(2, native_key_last);
+  state.set_word(3, ascon_common_utils::from_le_bytes(nonce.first<8>()));
+  state.set_word(4, ascon_common_utils::from_le_bytes(nonce.last<8>()));
 
-  state.permute<ASCON_PERM_NUM_ROUNDS_A>();
+  state.template permute<ASCON_PERM_NUM_ROUNDS_A>();
 
-  state[3] ^= key_first;
-  state[4] ^= key_last;
+  state.xor_native_word(3, native_key_first);
+  state.xor_native_word(4, native_key_last);
+}
+
+/**
+ * @brief Initializes the Ascon permutation state with the given key and nonce.
+ * See point 1 of section 4.1.1 in Ascon standard @ https://doi.org/10.6028/NIST.SP.800-232.
+ *
+ * @param state Ascon permutation state.
+ * @param key Encryption key.
+ * @param nonce Nonce - don't repeat it, for the same key !
+ */
+template<ascon_perm::ascon_perm_state perm_t>
+forceinline constexpr void
+initialize(perm_t& state, std::span<const uint8_t, KEY_BYTE_LEN> key, std::span<const uint8_t, NONCE_BYTE_LEN> nonce)
+{
+  initialize(state, ascon_common_utils::from_le_bytes(key.first<8>()), ascon_common_utils::from_le_bytes(key.last<8>()), nonce);
 }
 
 /**
@@ -57,11 +79,12 @@ initialize(ascon_perm::ascon_perm_t& state, std::span<const uint8_t, KEY_BYTE_LE
  * @param block_offset Offset within the current block, must be <= `RATE_BYTES`.
  * @param data Associated data to be absorbed.
  */
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-absorb_associated_data(ascon_perm::ascon_perm_t& state, size_t& block_offset, std::span<const uint8_t> data)
+absorb_associated_data(perm_t& state, size_t& block_offset, std::span<const uint8_t> data)
 {
   std::array<uint8_t, RATE_BYTES> block{};
-  auto block_span = std::span(block);
+  auto block_span = std::span<uint8_t, RATE_BYTES>(block);
 
   const size_t dlen = data.size();
   size_t data_offset = 0;
@@ -74,14 +97,17 @@ absorb_associated_data(ascon_perm::ascon_perm_t& state, size_t& block_offset, st
     std::copy_n(data.subspan(data_offset).begin(), to_be_absorbed_num_bytes, block_span.subspan(block_offset).begin());
     std::fill_n(block_span.subspan(block_offset + to_be_absorbed_num_bytes).begin(), block_span.size() - (block_offset + to_be_absorbed_num_bytes), 0);
 
-    state[0] ^= ascon_common_utils::from_le_bytes(block_span.first<8>());
-    state[1] ^= ascon_common_utils::from_le_bytes(block_span.last<8>());
+    state.xor_word(0, ascon_common_utils::from_le_bytes(block_span.first<8>()));
+    state.xor_word(1, ascon_common_utils::from_le_bytes(block_span.last<8>()));
 
     data_offset += to_be_absorbed_num_bytes;
     block_offset += to_be_absorbed_num_bytes;
 
+    const bool is_full_block = to_be_absorbed_num_bytes == RATE_BYTES;
+    ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::aead_associated_data, is_full_block, !is_full_block, to_be_absorbed_num_bytes);
+
     if (block_offset == RATE_BYTES) {
-      state.permute<ASCON_PERM_NUM_ROUNDS_B>();
+      state.template permute<ASCON_PERM_NUM_ROUNDS_B>();
       block_offset = 0;
     }
   }
@@ -96,24 +122,153 @@ absorb_associated_data(ascon_perm::ascon_perm_t& state, size_t& block_offset, st
  * @param block_offset Offset within the current block, must be <= `RATE_BYTES`.
  * @param absorbed_data_byte_len The total number of bytes of associated data absorbed.
  */
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-finalize_associated_data(ascon_perm::ascon_perm_t& state, size_t& block_offset, const size_t absorbed_data_byte_len)
+finalize_associated_data(perm_t& state, size_t& block_offset, const size_t absorbed_data_byte_len)
 {
   if (absorbed_data_byte_len > 0) {
     std::array<uint8_t, RATE_BYTES> block{};
-    auto block_span = std::span(block);
+    auto block_span = std::span<uint8_t, RATE_BYTES>(block);
 
     block_span[block_offset] = 0x01;
 
-    state[0] ^= ascon_common_utils::from_le_bytes(block_span.first<8>());
-    state[1] ^= ascon_common_utils::from_le_bytes(block_span.last<8>());
+    state.xor_word(0, ascon_common_utils::from_le_bytes(block_span.first<8>()));
+    state.xor_word(1, ascon_common_utils::from_le_bytes(block_span.last<8>()));
 
-    state.permute<ASCON_PERM_NUM_ROUNDS_B>();
+    state.template permute<ASCON_PERM_NUM_ROUNDS_B>();
     block_offset = 0;
   }
 
   // Final 1 -bit domain separator constant mixing is mandatory
-  state[4] ^= (0b1ul << 63u);
+  state.xor_word(4, uint64_t{ 1 } << 63u);
+}
+
+/**
+ * @brief Absorbs a full block of associated data into the rate portion of Ascon permutation state.
+ *
+ * @param rate0 First word of the rate portion of permutation state.
+ * @param rate1 Second word of the rate portion of permutation state.
+ * @param data Full block of associated data to be absorbed.
+ */
+forceinline constexpr void
+absorb_block(uint64_t& rate0, uint64_t& rate1, std::span<const uint8_t, RATE_BYTES> data)
+{
+  rate0 ^= ascon_common_utils::load_le_u64(data.first<8>());
+  rate1 ^= ascon_common_utils::load_le_u64(data.last<8>());
+}
+
+/**
+ * @brief Absorbs last, partial (< `RATE_BYTES`) block of associated data into the rate portion of Ascon permutation state, followed by padding.
+ *
+ * @param rate0 First word of the rate portion of permutation state.
+ * @param rate1 Second word of the rate portion of permutation state.
+ * @param data Last block of associated data to be absorbed, must be < `RATE_BYTES`, can be empty.
+ */
+forceinline constexpr void
+absorb_last_block(uint64_t& rate0, uint64_t& rate1, std::span<const uint8_t> data)
+{
+  std::array<uint8_t, RATE_BYTES> block{};
+  auto block_span = std::span<uint8_t, RATE_BYTES>(block);
+
+  std::copy_n(data.begin(), data.size(), block_span.begin());
+  block_span[data.size()] = 0x01;
+
+  absorb_block(rate0, rate1, block_span);
+}
+
+/**
+ * @brief Encrypts a full block of plaintext, absorbing it into the rate portion of Ascon permutation state and producing a full block of ciphertext.
+ *
+ * @param rate0 First word of the rate portion of permutation state.
+ * @param rate1 Second word of the rate portion of permutation state.
+ * @param plaintext Full block of plaintext to be encrypted.
+ * @param ciphertext Full block of ciphertext produced. Can alias `plaintext`.
+ */
+forceinline constexpr void
+encrypt_block(uint64_t& rate0, uint64_t& rate1, std::span<const uint8_t, RATE_BYTES> plaintext, std::span<uint8_t, RATE_BYTES> ciphertext)
+{
+  rate0 ^= ascon_common_utils::load_le_u64(plaintext.first<8>());
+  rate1 ^= ascon_common_utils::load_le_u64(plaintext.last<8>());
+
+  ascon_common_utils::store_le_u64(rate0, ciphertext.first<8>());
+  ascon_common_utils::store_le_u64(rate1, ciphertext.last<8>());
+}
+
+/**
+ * @brief Encrypts last, partial (< `RATE_BYTES`) block of plaintext, absorbing it into the rate portion of Ascon permutation state, followed by padding.
+ *
+ * @param rate0 First word of the rate portion of permutation state.
+ * @param rate1 Second word of the rate portion of permutation state.
+ * @param plaintext Last block of plaintext to be encrypted, must be < `RATE_BYTES`, can be empty.
+ * @param ciphertext Last block of ciphertext produced, must be of same length as `plaintext`. Can alias `plaintext`.
+ */
+forceinline constexpr void
+encrypt_last_block(uint64_t& rate0, uint64_t& rate1, std::span<const uint8_t> plaintext, std::span<uint8_t> ciphertext)
+{
+  std::array<uint8_t, RATE_BYTES> block{};
+  auto block_span = std::span<uint8_t, RATE_BYTES>(block);
+
+  const size_t len = plaintext.size();
+
+  std::copy_n(plaintext.begin(), len, block_span.begin());
+  encrypt_block(rate0, rate1, block_span, block_span);
+  std::copy_n(block_span.begin(), len, ciphertext.begin());
+
+  std::fill(block_span.begin(), block_span.end(), 0x00);
+  block_span[len] = 0x01;
+
+  absorb_block(rate0, rate1, block_span);
+}
+
+/**
+ * @brief Decrypts a full block of ciphertext, replacing the rate portion of Ascon permutation state with it and producing a full block of plaintext.
+ *
+ * @param rate0 First word of the rate portion of permutation state.
+ * @param rate1 Second word of the rate portion of permutation state.
+ * @param ciphertext Full block of ciphertext to be decrypted.
+ * @param plaintext Full block of plaintext produced. Can alias `ciphertext`.
+ */
+forceinline constexpr void
+decrypt_block(uint64_t& rate0, uint64_t& rate1, std::span<const uint8_t, RATE_BYTES> ciphertext, std::span<uint8_t, RATE_BYTES> plaintext)
+{
+  const auto ct0 = ascon_common_utils::load_le_u64(ciphertext.first<8>());
+  const auto ct1 = ascon_common_utils::load_le_u64(ciphertext.last<8>());
+
+  ascon_common_utils::store_le_u64(rate0 ^ ct0, plaintext.first<8>());
+  ascon_common_utils::store_le_u64(rate1 ^ ct1, plaintext.last<8>());
+
+  rate0 = ct0;
+  rate1 = ct1;
+}
+
+/**
+ * @brief Decrypts last, partial (< `RATE_BYTES`) block of ciphertext, absorbing it into the rate portion of Ascon permutation state, followed by padding.
+ *
+ * @param rate0 First word of the rate portion of permutation state.
+ * @param rate1 Second word of the rate portion of permutation state.
+ * @param ciphertext Last block of ciphertext to be decrypted, must be < `RATE_BYTES`, can be empty.
+ * @param plaintext Last block of plaintext produced, must be of same length as `ciphertext`. Can alias `ciphertext`.
+ */
+forceinline constexpr void
+decrypt_last_block(uint64_t& rate0, uint64_t& rate1, std::span<const uint8_t> ciphertext, std::span<uint8_t> plaintext)
+{
+  std::array<uint8_t, RATE_BYTES> block{};
+  auto block_span = std::span<uint8_t, RATE_BYTES>(block);
+
+  const size_t len = ciphertext.size();
+
+  std::copy_n(ciphertext.begin(), len, block_span.begin());
+
+  std::array<uint8_t, RATE_BYTES> decrypted{};
+  ascon_common_utils::to_le_bytes(rate0 ^ ascon_common_utils::from_le_bytes(block_span.first<8>()), std::span(decrypted).first<8>());
+  ascon_common_utils::to_le_bytes(rate1 ^ ascon_common_utils::from_le_bytes(block_span.last<8>()), std::span(decrypted).last<8>());
+  std::copy_n(decrypted.begin(), len, plaintext.begin());
+
+  // Absorb ciphertext bytes i.e. plaintext bytes xor'ed into state, followed by padding.
+  std::fill_n(decrypted.begin() + len, RATE_BYTES - len, 0x00);
+  decrypted[len] = 0x01;
+
+  absorb_block(rate0, rate1, decrypted);
 }
 
 /**
@@ -126,16 +281,33 @@ finalize_associated_data(ascon_perm::ascon_perm_t& state, size_t& block_offset,
  * @param plaintext Plaintext to be absorbed.
  * @param ciphertext Ciphertext produced.
  */
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-encrypt_plaintext(ascon_perm::ascon_perm_t& state, size_t& block_offset, std::span<const uint8_t> plaintext, std::span<uint8_t> ciphertext)
+encrypt_plaintext(perm_t& state, size_t& block_offset, std::span<const uint8_t> plaintext, std::span<uint8_t> ciphertext)
 {
   std::array<uint8_t, RATE_BYTES> block{};
-  auto block_span = std::span(block);
+  auto block_span = std::span<uint8_t, RATE_BYTES>(block);
 
   const size_t ptlen = plaintext.size();
   size_t pt_offset = 0;
 
   while (pt_offset < ptlen) {
+    // Full, block-aligned plaintext blocks are encrypted directly from input to output, without being staged.
+    if ((block_offset == 0) && ((ptlen - pt_offset) >= RATE_BYTES)) {
+      uint64_t rate0 = state[0];
+      uint64_t rate1 = state[1];
+
+      encrypt_block(rate0, rate1, plaintext.subspan(pt_offset).first<RATE_BYTES>(), ciphertext.subspan(pt_offset).first<RATE_BYTES>());
+
+      state.set_word(0, rate0);
+      state.set_word(1, rate1);
+      state.template permute<ASCON_PERM_NUM_ROUNDS_B>();
+      ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::aead_encrypt, 1, 0, RATE_BYTES);
+
+      pt_offset += RATE_BYTES;
+      continue;
+    }
+
     const size_t absorbable_num_bytes = RATE_BYTES - block_offset;
     const size_t remaining_num_bytes = ptlen - pt_offset;
     const size_t to_be_absorbed_num_bytes = std::min(absorbable_num_bytes, remaining_num_bytes);
@@ -143,8 +315,8 @@ encrypt_plaintext(ascon_perm::ascon_perm_t& state, size_t& block_offset, std::sp
     std::copy_n(plaintext.subspan(pt_offset).begin(), to_be_absorbed_num_bytes, block_span.subspan(block_offset).begin());
     std::fill_n(block_span.subspan(block_offset + to_be_absorbed_num_bytes).begin(), block_span.size() - (block_offset + to_be_absorbed_num_bytes), 0);
 
-    state[0] ^= ascon_common_utils::from_le_bytes(block_span.first<8>());
-    state[1] ^= ascon_common_utils::from_le_bytes(block_span.last<8>());
+    state.xor_word(0, ascon_common_utils::from_le_bytes(block_span.first<8>()));
+    state.xor_word(1, ascon_common_utils::from_le_bytes(block_span.last<8>()));
 
     ascon_common_utils::to_le_bytes(state[0], block_span.first<8>());
     ascon_common_utils::to_le_bytes(state[1], block_span.last<8>());
@@ -154,8 +326,11 @@ encrypt_plaintext(ascon_perm::ascon_perm_t& state, size_t& block_offset, std::sp
     pt_offset += to_be_absorbed_num_bytes;
     block_offset += to_be_absorbed_num_bytes;
 
+    const bool is_full_block = to_be_absorbed_num_bytes == RATE_BYTES;
+    ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::aead_encrypt, is_full_block, !is_full_block, to_be_absorbed_num_bytes);
+
     if (block_offset == RATE_BYTES) {
-      state.permute<ASCON_PERM_NUM_ROUNDS_B>();
+      state.template permute<ASCON_PERM_NUM_ROUNDS_B>();
       block_offset = 0;
     }
   }
@@ -171,16 +346,33 @@ encrypt_plaintext(ascon_perm::ascon_perm_t& state, size_t& block_offset, std::sp
  * @param ciphertext Ciphertext to be decrypted.
  * @param plaintext Plaintext produced.
  */
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-decrypt_ciphertext(ascon_perm::ascon_perm_t& state, size_t& block_offset, std::span<const uint8_t> ciphertext, std::span<uint8_t> plaintext)
+decrypt_ciphertext(perm_t& state, size_t& block_offset, std::span<const uint8_t> ciphertext, std::span<uint8_t> plaintext)
 {
   std::array<uint8_t, RATE_BYTES> block{};
-  auto block_span = std::span(block);
+  auto block_span = std::span<uint8_t, RATE_BYTES>(block);
 
   const size_t ctlen = ciphertext.size();
   size_t ct_offset = 0;
 
   while (ct_offset < ctlen) {
+    // Full, block-aligned ciphertext blocks are decrypted directly from input to output, without being staged.
+    if ((block_offset == 0) && ((ctlen - ct_offset) >= RATE_BYTES)) {
+      uint64_t rate0 = state[0];
+      uint64_t rate1 = state[1];
+
+      decrypt_block(rate0, rate1, ciphertext.subspan(ct_offset).first<RATE_BYTES>(), plaintext.subspan(ct_offset).first<RATE_BYTES>());
+
+      state.set_word(0, rate0);
+      state.set_word(1, rate1);
+      state.template permute<ASCON_PERM_NUM_ROUNDS_B>();
+      ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::aead_decrypt, 1, 0, RATE_BYTES);
+
+      ct_offset += RATE_BYTES;
+      continue;
+    }
+
     const size_t absorbable_num_bytes = RATE_BYTES - block_offset;
     const size_t remaining_num_bytes = ctlen - ct_offset;
     const size_t to_be_absorbed_num_bytes = std::min(absorbable_num_bytes, remaining_num_bytes);
@@ -195,14 +387,17 @@ decrypt_ciphertext(ascon_perm::ascon_perm_t& state, size_t& block_offset, std::s
     std::fill_n(block_span.begin(), block_offset, 0);
     std::fill_n(block_span.subspan(block_offset + to_be_absorbed_num_bytes).begin(), block_span.size() - (block_offset + to_be_absorbed_num_bytes), 0);
 
-    state[0] ^= ascon_common_utils::from_le_bytes(block_span.first<8>());
-    state[1] ^= ascon_common_utils::from_le_bytes(block_span.last<8>());
+    state.xor_word(0, ascon_common_utils::from_le_bytes(block_span.first<8>()));
+    state.xor_word(1, ascon_common_utils::from_le_bytes(block_span.last<8>()));
 
     ct_offset += to_be_absorbed_num_bytes;
     block_offset += to_be_absorbed_num_bytes;
 
+    const bool is_full_block = to_be_absorbed_num_bytes == RATE_BYTES;
+    ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::aead_decrypt, is_full_block, !is_full_block, to_be_absorbed_num_bytes);
+
     if (block_offset == RATE_BYTES) {
-      state.permute<ASCON_PERM_NUM_ROUNDS_B>();
+      state.template permute<ASCON_PERM_NUM_ROUNDS_B>();
       block_offset = 0;
     }
   }
@@ -216,41 +411,56 @@ decrypt_ciphertext(ascon_perm::ascon_perm_t& state, size_t& block_offset, std::s
  * @param state Ascon permutation state.
  * @param block_offset Offset within the current block, must be <= `RATE_BYTES`.
  */
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-finalize_ciphering(ascon_perm::ascon_perm_t& state, size_t& block_offset)
+finalize_ciphering(perm_t& state, size_t& block_offset)
 {
   std::array<uint8_t, RATE_BYTES> block{};
-  auto block_span = std::span(block);
+  auto block_span = std::span<uint8_t, RATE_BYTES>(block);
 
   block_span[block_offset] = 0x01;
 
-  state[0] ^= ascon_common_utils::from_le_bytes(block_span.first<8>());
-  state[1] ^= ascon_common_utils::from_le_bytes(block_span.last<8>());
+  state.xor_word(0, ascon_common_utils::from_le_bytes(block_span.first<8>()));
+  state.xor_word(1, ascon_common_utils::from_le_bytes(block_span.last<8>()));
 
   block_offset = 0;
 }
 
 /**
- * @brief Finalizes the Ascon permutation state and produces a tag.
+ * @brief Finalizes the Ascon permutation state and produces a tag, using the key, already parsed as two 64 -bit words.
  * See point 4 of section 4.1.1 in Ascon standard @ https://doi.org/10.6028/NIST.SP.800-232.
  *
  * @param state Ascon permutation state.
- * @param key Key used for encryption/decryption.
+ * @param key_first First 64 -bit word of the key used for encryption/decryption.
+ * @param key_last Last 64 -bit word of the key used for encryption/decryption.
  * @param tag Authentication tag produced.
  */
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-finalize(ascon_perm::ascon_perm_t& state, std::span<const uint8_t, KEY_BYTE_LEN> key, std::span<uint8_t, TAG_BYTE_LEN> tag)
+finalize(perm_t& state, const uint64_t key_first, const uint64_t key_last, std::span<uint8_t, TAG_BYTE_LEN> tag)
 {
-  const auto key_first = ascon_common_utils::from_le_bytes(key.first<8>());
-  const auto key_last = ascon_common_utils::from_le_bytes(key.last<8>());
-
-  state[2] ^= key_first;
-  state[3] ^= key_last;
+  state.xor_word(2, key_first);
+  state.xor_word(3, key_last);
 
-  state.permute<ASCON_PERM_NUM_ROUNDS_A>();
+  state.template permute<ASCON_PERM_NUM_ROUNDS_A>();
 
   ascon_common_utils::to_le_bytes(state[3] ^ key_first, tag.first<8>());
   ascon_common_utils::to_le_bytes(state[4] ^ key_last, tag.last<8>());
 }
 
+/**
+ * @brief Finalizes the Ascon permutation state and produces a tag.
+ * See point 4 of section 4.1.1 in Ascon standard @ https://doi.org/10.6028/NIST.SP.800-232.
+ *
+ * @param state Ascon permutation state.
+ * @param key Key used for encryption/decryption.
+ * @param tag Authentication tag produced.
+ */
+template<ascon_perm::ascon_perm_state perm_t>
+forceinline constexpr void
+finalize(perm_t& state, std::span<const uint8_t, KEY_BYTE_LEN> key, std::span<uint8_t, TAG_BYTE_LEN> tag)
+{
+  finalize(state, ascon_common_utils::from_le_bytes(key.first<8>()), ascon_common_utils::from_le_bytes(key.last<8>()), tag);
+}
+
 }
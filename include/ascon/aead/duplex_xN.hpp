@@ -0,0 +1,173 @@
+#pragma once
+#include "ascon/aead/duplex.hpp"
+#include "ascon/permutation/ascon_xN.hpp"
+#include "ascon/utils/common.hpp"
+#include "ascon/utils/force_inline.hpp"
+#include "ascon/utils/instrumentation.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace ascon_duplex_mode {
+
+/**
+ * @brief Runs Ascon-AEAD128 encryption or decryption of up to LANES independent messages, in lockstep, using the multi-lane Ascon permutation. Each phase -
+ * initialization, associated data absorption, plaintext/ciphertext processing and finalization - is applied to all lanes together. As lanes may be carrying
+ * associated data and plaintext/ciphertext of different lengths, lanes which are done with a phase are masked off i.e. not permuted, until others catch up.
+ * Only lanes carrying a message are counted by instrumentation, along with blocks and bytes of each of them.
+ * See section 4.1 of Ascon standard @ https://doi.org/10.6028/NIST.SP.800-232.
+ *
+ * @param num_lanes Number of lanes carrying a message, must be <= LANES. Only first `num_lanes` entries of following arrays are accessed.
+ * @param keys Encryption keys, each must be `KEY_BYTE_LEN` -bytes.
+ * @param nonces Nonces, each must be `NONCE_BYTE_LEN` -bytes.
+ * @param associated_data Associated data, to be absorbed.
+ * @param inputs Plaintext (when encrypting) or ciphertext (when decrypting).
+ * @param outputs Ciphertext (when encrypting) or plaintext (when decrypting), each must be of same length as corresponding input. Can alias input.
+ * @param tags Computed authentication tags.
+ */
+template<const size_t LANES, const bool is_decrypting>
+forceinline constexpr void
+process_lanes(const size_t num_lanes,
+              const std::array<std::span<const uint8_t>, LANES>& keys,
+              const std::array<std::span<const uint8_t>, LANES>& nonces,
+              const std::array<std::span<const uint8_t>, LANES>& associated_data,
+              const std::array<std::span<const uint8_t>, LANES>& inputs,
+              const std::array<std::span<uint8_t>, LANES>& outputs,
+              std::array<std::array<uint8_t, TAG_BYTE_LEN>, LANES>& tags)
+{
+  ascon_perm::ascon_perm_xN_t<LANES> state;
+
+  std::array<uint64_t, LANES> key_first{};
+  std::array<uint64_t, LANES> key_last{};
+
+  // Initialization
+  for (size_t lane = 0; lane < num_lanes; lane++) {
+    key_first[lane] = ascon_common_utils::from_le_bytes(keys[lane].template first<8>());
+    key_last[lane] = ascon_common_utils::from_le_bytes(keys[lane].template last<8>());
+
+    state(0, lane) = INITIAL_VALUE;
+    state(1, lane) = key_first[lane];
+    state(2, lane) = key_last[lane];
+    state(3, lane) = ascon_common_utils::from_le_bytes(nonces[lane].template first<8>());
+    state(4, lane) = ascon_common_utils::from_le_bytes(nonces[lane].template last<8>());
+  }
+
+  state.template permute<ASCON_PERM_NUM_ROUNDS_A>(num_lanes);
+
+  for (size_t lane = 0; lane < num_lanes; lane++) {
+    state(3, lane) ^= key_first[lane];
+    state(4, lane) ^= key_last[lane];
+  }
+
+  // Associated data absorption, each non-empty associated data takes full blocks + 1 padded last block -many permutations.
+  {
+    size_t max_num_steps = 0;
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      const size_t ad_byte_len = associated_data[lane].size();
+      const size_t num_steps = (ad_byte_len == 0) ? 0 : (ad_byte_len / RATE_BYTES + 1);
+      max_num_steps = std::max(max_num_steps, num_steps);
+
+      ascon_instrumentation::record_blocks(
+        ascon_instrumentation::phase_t::aead_associated_data, ad_byte_len / RATE_BYTES, (ad_byte_len % RATE_BYTES) > 0, ad_byte_len);
+    }
+
+    for (size_t step = 0; step < max_num_steps; step++) {
+      std::array<bool, LANES> is_active{};
+
+      for (size_t lane = 0; lane < num_lanes; lane++) {
+        const auto data = associated_data[lane];
+        const size_t num_full_blocks = data.size() / RATE_BYTES;
+
+        if (data.empty() || step > num_full_blocks) {
+          continue;
+        }
+
+        if (step < num_full_blocks) {
+          absorb_block(state(0, lane), state(1, lane), data.subspan(step * RATE_BYTES).template first<RATE_BYTES>());
+        } else {
+          absorb_last_block(state(0, lane), state(1, lane), data.subspan(step * RATE_BYTES));
+        }
+
+        is_active[lane] = true;
+      }
+
+      state.template permute<ASCON_PERM_NUM_ROUNDS_B>(is_active);
+    }
+
+    // Final 1 -bit domain separator constant mixing is mandatory
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      state(4, lane) ^= (uint64_t{ 1 } << 63u);
+    }
+  }
+
+  // Plaintext/ ciphertext processing, full blocks need a permutation each, while the last partial block doesn't.
+  {
+    constexpr auto phase = is_decrypting ? ascon_instrumentation::phase_t::aead_decrypt : ascon_instrumentation::phase_t::aead_encrypt;
+
+    size_t max_num_full_blocks = 0;
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      const size_t in_byte_len = inputs[lane].size();
+      max_num_full_blocks = std::max(max_num_full_blocks, in_byte_len / RATE_BYTES);
+
+      ascon_instrumentation::record_blocks(phase, in_byte_len / RATE_BYTES, (in_byte_len % RATE_BYTES) > 0, in_byte_len);
+    }
+
+    for (size_t step = 0; step < max_num_full_blocks; step++) {
+      std::array<bool, LANES> is_active{};
+
+      for (size_t lane = 0; lane < num_lanes; lane++) {
+        if (step >= inputs[lane].size() / RATE_BYTES) {
+          continue;
+        }
+
+        const auto in = inputs[lane].subspan(step * RATE_BYTES).template first<RATE_BYTES>();
+        const auto out = outputs[lane].subspan(step * RATE_BYTES).template first<RATE_BYTES>();
+
+        if constexpr (is_decrypting) {
+          decrypt_block(state(0, lane), state(1, lane), in, out);
+        } else {
+          encrypt_block(state(0, lane), state(1, lane), in, out);
+        }
+
+        is_active[lane] = true;
+      }
+
+      state.template permute<ASCON_PERM_NUM_ROUNDS_B>(is_active);
+    }
+
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      const size_t offset = (inputs[lane].size() / RATE_BYTES) * RATE_BYTES;
+
+      const auto in = inputs[lane].subspan(offset);
+      const auto out = outputs[lane].subspan(offset, in.size());
+
+      if constexpr (is_decrypting) {
+        decrypt_last_block(state(0, lane), state(1, lane), in, out);
+      } else {
+        encrypt_last_block(state(0, lane), state(1, lane), in, out);
+      }
+    }
+  }
+
+  // Finalization
+  for (size_t lane = 0; lane < num_lanes; lane++) {
+    state(2, lane) ^= key_first[lane];
+    state(3, lane) ^= key_last[lane];
+  }
+
+  state.template permute<ASCON_PERM_NUM_ROUNDS_A>(num_lanes);
+
+  for (size_t lane = 0; lane < num_lanes; lane++) {
+    auto tag = std::span(tags[lane]);
+
+    ascon_common_utils::to_le_bytes(state(3, lane) ^ key_first[lane], tag.template first<8>());
+    ascon_common_utils::to_le_bytes(state(4, lane) ^ key_last[lane], tag.template last<8>());
+  }
+
+  ascon_common_utils::secure_wipe(std::span(key_first));
+  ascon_common_utils::secure_wipe(std::span(key_last));
+}
+
+}
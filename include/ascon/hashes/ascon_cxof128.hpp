@@ -1,5 +1,6 @@
 #pragma once
 #include "ascon/hashes/sponge.hpp"
+#include "ascon/utils/tracing.hpp"
 
 namespace ascon_cxof128 {
 
@@ -50,6 +51,101 @@ enum class ascon_cxof128_status_t : uint8_t
   squeezed_output
 };
 
+// Absorbs bit length of the customization string, followed by the string itself, into freshly initialized Ascon-CXOF128 permutation state, finalizing it.
+forceinline constexpr void
+absorb_customization_string(ascon_perm::ascon_perm_t& state, std::span<const uint8_t> cust_str)
+{
+  const size_t cust_str_bit_len = cust_str.size() * std::numeric_limits<uint8_t>::digits;
+
+  std::array<uint8_t, ascon_sponge_mode::RATE_BYTES> cust_str_bit_len_as_bytes{};
+  ascon_common_utils::to_le_bytes(cust_str_bit_len, cust_str_bit_len_as_bytes);
+
+  size_t offset = 0;
+
+  ascon_sponge_mode::absorb(state, offset, cust_str_bit_len_as_bytes);
+  ascon_sponge_mode::absorb(state, offset, cust_str);
+  ascon_sponge_mode::finalize(state, offset);
+}
+
+/**
+ * @brief Ascon-CXOF128 permutation state, right after being customized, which can be computed once (even during program compilation time) and then used for
+ * starting any number of `ascon_cxof128_t` instances, which skip absorbing the same customization string all over again.
+ */
+struct ascon_cxof128_prefix_t
+{
+private:
+  ascon_perm::ascon_perm_t state = INITIAL_PERMUTATION_STATE;
+  alignas(4) bool has_customized = false;
+
+public:
+  // Constructor(s)/ Destructor(s)
+  forceinline constexpr ascon_cxof128_prefix_t() = default;
+  forceinline constexpr ~ascon_cxof128_prefix_t()
+  {
+    state.reset();
+    has_customized = false;
+  }
+
+  /**
+   * @brief Customizes the prefix state with a given customization string, same as `ascon_cxof128_t::customize` does.
+   *
+   * @param cust_str The customization string.
+   * @return An `ascon_cxof128_status_t` indicating the success or reason for failure (e.g., `customized`, `already_customized`,
+   * `failed_to_customize_with_too_long_string`).
+   */
+  [[nodiscard]]
+  forceinline constexpr ascon_cxof128_status_t customize(std::span<const uint8_t> cust_str)
+  {
+    ASCON_TRACE_SCOPE(cxof128_customize, cust_str.size());
+
+    if (has_customized) {
+      return ascon_cxof128_status_t::already_customized;
+    }
+    if (cust_str.size() > CUSTOMIZATION_STRING_MAX_BYTE_LEN) {
+      return ascon_cxof128_status_t::failed_to_customize_with_too_long_string;
+    }
+
+    absorb_customization_string(state, cust_str);
+
+    has_customized = true;
+    return ascon_cxof128_status_t::customized;
+  }
+
+  // Accessor(s)
+  [[nodiscard]]
+  forceinline constexpr bool is_customized() const
+  {
+    return has_customized;
+  }
+  [[nodiscard]]
+  forceinline constexpr ascon_perm::ascon_perm_t permutation_state() const
+  {
+    return state;
+  }
+};
+
+/**
+ * @brief Compile-time computes Ascon-CXOF128 prefix state, customized with given string literal, excluding its null terminator.
+ *
+ * @param cust_str The customization string, as a string literal.
+ * @return Customized prefix state.
+ */
+template<const size_t N>
+consteval ascon_cxof128_prefix_t
+compute_prefix(const char (&cust_str)[N])
+  requires((N > 0) && ((N - 1) <= CUSTOMIZATION_STRING_MAX_BYTE_LEN))
+{
+  std::array<uint8_t, N - 1> cust_str_bytes{};
+  for (size_t i = 0; i < cust_str_bytes.size(); i++) {
+    cust_str_bytes[i] = static_cast<uint8_t>(cust_str[i]);
+  }
+
+  ascon_cxof128_prefix_t prefix;
+  (void)prefix.customize(cust_str_bytes);
+
+  return prefix;
+}
+
 /**
  * @brief Represents an Ascon CXOF-128 instance offering 128-bit security.
  *
@@ -68,6 +164,21 @@ private:
 public:
   // Constructor(s)/ Destructor(s)
   forceinline constexpr ascon_cxof128_t() = default;
+  forceinline constexpr ascon_cxof128_t(const ascon_cxof128_t&) = default;
+  forceinline constexpr ascon_cxof128_t& operator=(const ascon_cxof128_t&) = default;
+
+  /**
+   * @brief Starts an Ascon-CXOF128 instance from a precomputed prefix state. If the prefix state is customized, so is the instance i.e. it's ready to absorb
+   * data, without running any permutation for customization.
+   *
+   * @param prefix Precomputed prefix state, see `ascon_cxof128_prefix_t`.
+   */
+  forceinline constexpr explicit ascon_cxof128_t(const ascon_cxof128_prefix_t& prefix)
+    : state(prefix.permutation_state())
+    , has_customized(prefix.is_customized())
+  {
+  }
+
   forceinline constexpr ~ascon_cxof128_t()
   {
     state.reset();
@@ -90,6 +201,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_cxof128_status_t customize(std::span<const uint8_t> cust_str)
   {
+    ASCON_TRACE_SCOPE(cxof128_customize, cust_str.size());
+
     if (has_customized) {
       return ascon_cxof128_status_t::already_customized;
     }
@@ -97,14 +210,7 @@ public:
       return ascon_cxof128_status_t::failed_to_customize_with_too_long_string;
     }
 
-    const size_t cust_str_bit_len = cust_str.size() * std::numeric_limits<uint8_t>::digits;
-
-    std::array<uint8_t, ascon_sponge_mode::RATE_BYTES> cust_str_bit_len_as_bytes{};
-    ascon_common_utils::to_le_bytes(cust_str_bit_len, cust_str_bit_len_as_bytes);
-
-    ascon_sponge_mode::absorb(state, offset, cust_str_bit_len_as_bytes);
-    ascon_sponge_mode::absorb(state, offset, cust_str);
-    ascon_sponge_mode::finalize(state, offset);
+    absorb_customization_string(state, cust_str);
 
     has_customized = true;
     return ascon_cxof128_status_t::customized;
@@ -123,6 +229,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_cxof128_status_t absorb(std::span<const uint8_t> msg)
   {
+    ASCON_TRACE_SCOPE(cxof128_absorb, msg.size());
+
     if (!has_customized) {
       return ascon_cxof128_status_t::not_yet_customized;
     }
@@ -146,6 +254,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_cxof128_status_t finalize()
   {
+    ASCON_TRACE_SCOPE(cxof128_finalize, 0);
+
     if (!has_customized) {
       return ascon_cxof128_status_t::not_yet_customized;
     }
@@ -173,6 +283,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_cxof128_status_t squeeze(std::span<uint8_t> out)
   {
+    ASCON_TRACE_SCOPE(cxof128_squeeze, out.size());
+
     if (!has_customized) {
       return ascon_cxof128_status_t::not_yet_customized;
     }
@@ -1,5 +1,7 @@
 #pragma once
 #include "ascon/hashes/sponge.hpp"
+#include "ascon/hashes/sponge_xN.hpp"
+#include "ascon/utils/tracing.hpp"
 
 namespace ascon_hash256 {
 
@@ -39,6 +41,12 @@ enum class ascon_hash256_status_t : uint8_t
 
   /// @brief Indicates that the message digest has already been produced.
   message_digest_already_produced,
+
+  /// @brief Indicates that message digests for a batch of messages were successfully produced.
+  batch_message_digests_produced,
+
+  /// @brief Indicates that the number of messages and the number of digests, in a batch, don't match.
+  batch_size_mismatch,
 };
 
 /**
@@ -84,6 +92,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_hash256_status_t absorb(std::span<const uint8_t> msg)
   {
+    ASCON_TRACE_SCOPE(hash256_absorb, msg.size());
+
     if (finished_absorbing) {
       return ascon_hash256_status_t::data_absorption_phase_already_finalized;
     }
@@ -106,6 +116,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_hash256_status_t finalize()
   {
+    ASCON_TRACE_SCOPE(hash256_finalize, 0);
+
     if (finished_absorbing) {
       return ascon_hash256_status_t::data_absorption_phase_already_finalized;
     }
@@ -130,6 +142,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_hash256_status_t digest(std::span<uint8_t, DIGEST_BYTE_LEN> out)
   {
+    ASCON_TRACE_SCOPE(hash256_digest, out.size());
+
     if (!finished_absorbing) {
       return ascon_hash256_status_t::still_in_data_absorption_phase;
     }
@@ -147,4 +161,52 @@ public:
   }
 };
 
+/**
+ * @brief Computes Ascon-Hash256 digests of a batch of independent messages, in one go.
+ *
+ * Instead of hashing one message at a time, this function interleaves LANES sponge states through the multi-lane Ascon permutation. Messages can be of
+ * arbitrary, different lengths - as soon as a lane is done with its message, it picks up the next message from the batch. For short messages, this gives much
+ * better throughput than hashing each of them using `ascon_hash256_t`, as the permutation, which dominates cost of hashing, gets to process many states at once.
+ *
+ * @param msgs A span of messages to be hashed.
+ * @param digests A span where the resulting digests will be written, one for each message, in same order.
+ * @return An `ascon_hash256_status_t` indicating if all message digests were successfully produced (`ascon_hash256_status_t::batch_message_digests_produced`)
+ * or if the number of messages and digests don't match (`ascon_hash256_status_t::batch_size_mismatch`).
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+[[nodiscard]]
+forceinline constexpr ascon_hash256_status_t
+hash_many(std::span<const std::span<const uint8_t>> msgs, std::span<std::array<uint8_t, DIGEST_BYTE_LEN>> digests)
+{
+  if (msgs.size() != digests.size()) {
+    return ascon_hash256_status_t::batch_size_mismatch;
+  }
+
+  ascon_sponge_mode::absorb_and_squeeze_many<DIGEST_BYTE_LEN, LANES>(INITIAL_PERMUTATION_STATE, msgs, digests);
+  return ascon_hash256_status_t::batch_message_digests_produced;
+}
+
+/**
+ * @brief Computes Ascon-Hash256 digest of a message, whose length is known during program compilation e.g. a 32 -byte key or a 64 -byte pair of tree
+ * nodes. Message blocks are absorbed, and the digest is squeezed, in loops of compile-time known trip count, skipping the offset bookkeeping and partial
+ * block handling of `ascon_hash256_t`. Produces same digest as `ascon_hash256_t`.
+ *
+ * @param msg Message of MSG_BYTE_LEN -bytes, to be hashed.
+ * @param digest A span where the resulting digest will be written.
+ */
+template<const size_t MSG_BYTE_LEN>
+forceinline constexpr void
+hash(std::span<const uint8_t, MSG_BYTE_LEN> msg, std::span<uint8_t, DIGEST_BYTE_LEN> digest)
+  requires(MSG_BYTE_LEN != std::dynamic_extent)
+{
+  ASCON_TRACE_SCOPE(hash256_hash, MSG_BYTE_LEN);
+
+  auto state = INITIAL_PERMUTATION_STATE;
+
+  ascon_sponge_mode::absorb_and_finalize(state, msg);
+  ascon_sponge_mode::squeeze_all(state, digest);
+
+  state.reset();
+}
+
 }
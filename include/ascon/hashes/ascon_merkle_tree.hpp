@@ -0,0 +1,379 @@
+#pragma once
+#include "ascon/hashes/ascon_hash256.hpp"
+#include "ascon/hashes/sponge.hpp"
+#include "ascon/hashes/sponge_xN.hpp"
+#include "ascon/utils/thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Binary Merkle tree, built on Ascon-Hash256, over an ordered list of leaves, of arbitrary lengths.
+//
+// - Hash of a leaf is Ascon-Hash256(le64(0) || leaf).
+// - Hash of an inner node is Ascon-Hash256(le64(1) || left child hash || right child hash).
+//
+// The tree is left-balanced, same as the one of RFC 9162 (Certificate Transparency v2) i.e. left subtree of any node covers the largest power of 2 -many
+// leaves, strictly less than the total covered by that node. Equivalently, nodes of each level are paired from left to right, while the odd one out, if any,
+// is carried up, to be paired at the next level. Nodes of each level are kept in a flat array, so that the tree can be built level by level, hashing many
+// independent nodes at once, using the multi-lane Ascon permutation and multiple threads.
+namespace ascon_merkle_tree {
+
+static constexpr size_t DIGEST_BYTE_LEN = ascon_hash256::DIGEST_BYTE_LEN;
+
+using digest_t = std::array<uint8_t, DIGEST_BYTE_LEN>;
+
+// Domain separators, for leaves and inner nodes, absorbed as the first message block.
+static constexpr uint64_t LEAF_DOMAIN = 0;
+static constexpr uint64_t NODE_DOMAIN = 1;
+
+// Compile-time computes Ascon-Hash256 permutation state, right after absorbing le64(domain) as the first message block, so that hashing a leaf or an inner
+// node starts from it, instead of absorbing the domain separator all over again.
+[[nodiscard]]
+consteval ascon_perm::ascon_perm_t
+compute_domain_separated_init_state(const uint64_t domain)
+{
+  std::array<uint8_t, ascon_sponge_mode::RATE_BYTES> domain_as_bytes{};
+  ascon_common_utils::to_le_bytes(domain, domain_as_bytes);
+
+  auto state = ascon_hash256::INITIAL_PERMUTATION_STATE;
+  size_t offset = 0;
+
+  ascon_sponge_mode::absorb(state, offset, domain_as_bytes);
+  return state;
+}
+
+static constexpr auto LEAF_INIT_STATE = compute_domain_separated_init_state(LEAF_DOMAIN);
+static constexpr auto NODE_INIT_STATE = compute_domain_separated_init_state(NODE_DOMAIN);
+
+// Computes hash of a leaf.
+forceinline constexpr void
+hash_leaf(std::span<const uint8_t> leaf, std::span<uint8_t, DIGEST_BYTE_LEN> digest)
+{
+  auto state = LEAF_INIT_STATE;
+  size_t offset = 0;
+  size_t readable = ascon_sponge_mode::RATE_BYTES;
+
+  ascon_sponge_mode::absorb(state, offset, leaf);
+  ascon_sponge_mode::finalize(state, offset);
+  ascon_sponge_mode::squeeze(state, readable, digest);
+}
+
+// Computes hash of an inner node, from hashes of its children. Output can alias either of the inputs.
+forceinline constexpr void
+hash_node(std::span<const uint8_t, DIGEST_BYTE_LEN> left, std::span<const uint8_t, DIGEST_BYTE_LEN> right, std::span<uint8_t, DIGEST_BYTE_LEN> parent)
+{
+  std::array<uint8_t, 2 * DIGEST_BYTE_LEN> children{};
+  auto children_span = std::span(children);
+
+  std::copy(left.begin(), left.end(), children_span.first<DIGEST_BYTE_LEN>().begin());
+  std::copy(right.begin(), right.end(), children_span.last<DIGEST_BYTE_LEN>().begin());
+
+  auto state = NODE_INIT_STATE;
+
+  ascon_sponge_mode::absorb_and_finalize(state, std::span<const uint8_t, 2 * DIGEST_BYTE_LEN>(children));
+  ascon_sponge_mode::squeeze_all(state, parent);
+}
+
+/// @brief Enumeration representing the status of Merkle tree operations.
+enum class ascon_merkle_tree_status_t : uint8_t
+{
+  /// @brief Root hash was successfully computed, by `root()`.
+  computed_root = 0x01,
+
+  /// @brief Tree has no leaves, so it has no root, and no inclusion proofs.
+  empty_tree,
+
+  /// @brief Inclusion proof was successfully generated, by `prove()`.
+  generated_proof,
+
+  /// @brief Requested leaf index is not less than the number of leaves in the tree.
+  leaf_index_out_of_range,
+
+  /// @brief Inclusion proof was found to be valid, by `verify()`.
+  verified_proof,
+
+  /// @brief Inclusion proof was found to be invalid, by `verify()`.
+  failed_to_verify_proof,
+};
+
+/**
+ * @brief Ascon-Hash256 based Merkle tree, keeping all nodes, one flat array per level, so that inclusion proofs can be generated without rehashing anything.
+ * Level 0 holds leaf hashes, level `i + 1` holds hashes of pairs of adjacent nodes of level `i` i.e. it's half as long, rounded down. Nodes carried up, from
+ * odd-length levels, along with their ancestors, are not stored - they lie on the right edge of the tree and are recomputed on demand, which takes at most
+ * one node hash per level.
+ */
+struct ascon_merkle_tree_t
+{
+private:
+  std::vector<std::vector<digest_t>> levels;
+
+  // Computes the node carried into each level from below, for all levels - `has_carry` tells whether a level has one - along with the root hash.
+  forceinline void compute_right_edge(std::vector<digest_t>& carries, std::vector<bool>& has_carry, std::span<uint8_t, DIGEST_BYTE_LEN> root_hash) const
+  {
+    carries.assign(levels.size() + 1, digest_t{});
+    has_carry.assign(levels.size() + 1, false);
+
+    for (size_t level = 0; level < levels.size(); level++) {
+      const auto& nodes = levels[level];
+
+      if ((nodes.size() & 1) == 1) {
+        if (has_carry[level]) {
+          hash_node(nodes.back(), carries[level], carries[level + 1]);
+        } else {
+          carries[level + 1] = nodes.back();
+        }
+        has_carry[level + 1] = true;
+      } else {
+        carries[level + 1] = carries[level];
+        has_carry[level + 1] = has_carry[level];
+      }
+    }
+
+    // Topmost level always holds a single node, so it's carried up as the root.
+    std::copy(carries.back().begin(), carries.back().end(), root_hash.begin());
+  }
+
+  // Appends parents of all complete pairs of nodes at `level`, computed LANES at a time, on all threads of the pool, as next level of the tree.
+  template<const size_t LANES>
+  inline void build_next_level(ascon_parallel::thread_pool_t& pool, const size_t level)
+  {
+    // Number of nodes a thread picks up at once, large enough to amortize the cost of picking up work, small enough to balance load across threads.
+    constexpr size_t NODES_PER_RANGE = LANES * 64;
+
+    const auto& children = levels[level];
+    const size_t num_parents = children.size() / 2;
+
+    std::vector<digest_t> parents(num_parents);
+
+    pool.parallel_for(num_parents, NODES_PER_RANGE, [&](const size_t begin, const size_t end) {
+      std::vector<uint8_t> pairs((end - begin) * 2 * DIGEST_BYTE_LEN);
+      std::array<std::span<const uint8_t>, NODES_PER_RANGE> nodes{};
+
+      for (size_t i = begin; i < end; i++) {
+        auto pair = std::span(pairs).subspan((i - begin) * 2 * DIGEST_BYTE_LEN, 2 * DIGEST_BYTE_LEN);
+
+        std::copy(children[2 * i].begin(), children[2 * i].end(), pair.begin());
+        std::copy(children[2 * i + 1].begin(), children[2 * i + 1].end(), pair.begin() + DIGEST_BYTE_LEN);
+
+        nodes[i - begin] = pair;
+      }
+
+      ascon_sponge_mode::absorb_and_squeeze_many<DIGEST_BYTE_LEN, LANES>(
+        NODE_INIT_STATE, std::span(nodes).first(end - begin), std::span(parents).subspan(begin, end - begin));
+    });
+
+    levels.push_back(std::move(parents));
+  }
+
+public:
+  // Constructor(s)/ Destructor(s)
+  inline ascon_merkle_tree_t() = default;
+
+  // Returns number of leaves in the tree.
+  [[nodiscard]]
+  inline size_t leaf_count() const
+  {
+    return levels.empty() ? 0 : levels.front().size();
+  }
+
+  // Returns number of stored levels, including the level of leaf hashes. It's same as height of the tree plus one.
+  [[nodiscard]]
+  inline size_t level_count() const
+  {
+    return levels.size();
+  }
+
+  // Returns stored node hashes of given level.
+  [[nodiscard]]
+  inline std::span<const digest_t> nodes_at_level(const size_t level_idx) const
+  {
+    return levels[level_idx];
+  }
+
+  /**
+   * @brief Builds the tree from given leaves, discarding the previous content, if any. Leaves are hashed, followed by inner nodes, level by level, each level
+   * being split across all threads of the pool, each of which hashes LANES nodes at a time, using the multi-lane Ascon permutation.
+   *
+   * @param pool Thread pool, to run on.
+   * @param leaves Leaves of the tree, in order.
+   */
+  template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+  inline void build(ascon_parallel::thread_pool_t& pool, std::span<const std::span<const uint8_t>> leaves)
+  {
+    constexpr size_t LEAVES_PER_RANGE = LANES * 64;
+
+    levels.clear();
+    if (leaves.empty()) {
+      return;
+    }
+
+    std::vector<digest_t> leaf_hashes(leaves.size());
+
+    pool.parallel_for(leaves.size(), LEAVES_PER_RANGE, [&](const size_t begin, const size_t end) {
+      ascon_sponge_mode::absorb_and_squeeze_many<DIGEST_BYTE_LEN, LANES>(
+        LEAF_INIT_STATE, leaves.subspan(begin, end - begin), std::span(leaf_hashes).subspan(begin, end - begin));
+    });
+
+    levels.push_back(std::move(leaf_hashes));
+
+    while (levels.back().size() > 1) {
+      build_next_level<LANES>(pool, levels.size() - 1);
+    }
+  }
+
+  /**
+   * @brief Appends a leaf to the tree, hashing it and those inner nodes, which it completes - at most one per level.
+   *
+   * @param leaf Leaf to be appended.
+   */
+  inline void append(std::span<const uint8_t> leaf)
+  {
+    if (levels.empty()) {
+      levels.emplace_back();
+    }
+
+    digest_t node{};
+    hash_leaf(leaf, node);
+    levels.front().push_back(node);
+
+    for (size_t level = 0; (levels[level].size() & 1) == 0; level++) {
+      const auto& nodes = levels[level];
+      hash_node(nodes[nodes.size() - 2], nodes.back(), node);
+
+      if ((level + 1) == levels.size()) {
+        levels.emplace_back();
+      }
+      levels[level + 1].push_back(node);
+    }
+  }
+
+  /**
+   * @brief Computes root hash of the tree.
+   *
+   * @param root_hash Root hash, to be written.
+   * @return `ascon_merkle_tree_status_t::computed_root` or `ascon_merkle_tree_status_t::empty_tree`, if the tree has no leaves.
+   */
+  [[nodiscard]]
+  inline ascon_merkle_tree_status_t root(std::span<uint8_t, DIGEST_BYTE_LEN> root_hash) const
+  {
+    if (leaf_count() == 0) {
+      return ascon_merkle_tree_status_t::empty_tree;
+    }
+
+    std::vector<digest_t> carries;
+    std::vector<bool> has_carry;
+
+    compute_right_edge(carries, has_carry, root_hash);
+    return ascon_merkle_tree_status_t::computed_root;
+  }
+
+  /**
+   * @brief Generates inclusion proof for the leaf at given index i.e. hashes of siblings of all nodes on the path from that leaf to the root, bottom-up. It's
+   * the same audit path, as defined in section 2.1.3.1 of RFC 9162, which can be verified using `verify()`.
+   *
+   * @param leaf_idx Index of the leaf, whose inclusion is to be proven.
+   * @param proof Inclusion proof, to be written. Previous content, if any, is discarded.
+   * @return `ascon_merkle_tree_status_t::generated_proof` or `ascon_merkle_tree_status_t::leaf_index_out_of_range`.
+   */
+  [[nodiscard]]
+  inline ascon_merkle_tree_status_t prove(const size_t leaf_idx, std::vector<digest_t>& proof) const
+  {
+    if (leaf_idx >= leaf_count()) {
+      return ascon_merkle_tree_status_t::leaf_index_out_of_range;
+    }
+
+    std::vector<digest_t> carries;
+    std::vector<bool> has_carry;
+    digest_t root_hash{};
+
+    compute_right_edge(carries, has_carry, root_hash);
+
+    proof.clear();
+
+    // Once the path reaches a node, which is carried up, rest of it lies on the right edge of the tree.
+    size_t node_idx = leaf_idx;
+    bool is_carried = false;
+
+    for (size_t level = 0; level < levels.size(); level++) {
+      const auto& nodes = levels[level];
+
+      if (is_carried) {
+        // Carried node pairs up with the last node of the level, as its right child, if that one is left unpaired.
+        if ((nodes.size() & 1) == 1) {
+          proof.push_back(nodes.back());
+        }
+      } else if ((node_idx & 1) == 1) {
+        proof.push_back(nodes[node_idx - 1]);
+        node_idx >>= 1;
+      } else if ((node_idx + 1) < nodes.size()) {
+        proof.push_back(nodes[node_idx + 1]);
+        node_idx >>= 1;
+      } else {
+        // Last, unpaired node of the level, which either pairs up with the node carried from below, or gets carried up itself.
+        if (has_carry[level]) {
+          proof.push_back(carries[level]);
+        }
+        is_carried = true;
+      }
+    }
+
+    return ascon_merkle_tree_status_t::generated_proof;
+  }
+};
+
+/**
+ * @brief Verifies inclusion proof of a leaf, at given index, in a tree of given number of leaves, with given root hash, following algorithm described in
+ * section 2.1.3.2 of RFC 9162. Position of the leaf is bound by the proof i.e. a valid proof for one index doesn't verify for some other index.
+ *
+ * @param leaf The leaf, whose inclusion is to be verified.
+ * @param leaf_idx Index of the leaf.
+ * @param leaf_count Number of leaves in the tree.
+ * @param proof Inclusion proof, as generated by `ascon_merkle_tree_t::prove()`.
+ * @param root_hash Root hash of the tree.
+ * @return `ascon_merkle_tree_status_t::verified_proof` or `ascon_merkle_tree_status_t::failed_to_verify_proof`.
+ */
+[[nodiscard]]
+forceinline constexpr ascon_merkle_tree_status_t
+verify(std::span<const uint8_t> leaf,
+       const size_t leaf_idx,
+       const size_t leaf_count,
+       std::span<const digest_t> proof,
+       std::span<const uint8_t, DIGEST_BYTE_LEN> root_hash)
+{
+  if (leaf_idx >= leaf_count) {
+    return ascon_merkle_tree_status_t::failed_to_verify_proof;
+  }
+
+  size_t fn = leaf_idx;
+  size_t sn = leaf_count - 1;
+
+  digest_t r{};
+  hash_leaf(leaf, r);
+
+  for (const auto& p : proof) {
+    if (sn == 0) {
+      return ascon_merkle_tree_status_t::failed_to_verify_proof;
+    }
+
+    if (((fn & 1) == 1) || (fn == sn)) {
+      hash_node(p, r, r);
+
+      while (((fn & 1) == 0) && (fn != 0)) {
+        fn >>= 1;
+        sn >>= 1;
+      }
+    } else {
+      hash_node(r, p, r);
+    }
+
+    fn >>= 1;
+    sn >>= 1;
+  }
+
+  const bool is_matching = (sn == 0) && std::equal(r.begin(), r.end(), root_hash.begin());
+  return is_matching ? ascon_merkle_tree_status_t::verified_proof : ascon_merkle_tree_status_t::failed_to_verify_proof;
+}
+
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "ascon/hashes/ascon_cxof128.hpp"
+#include "ascon/hashes/sponge_xN.hpp"
+#include "ascon/utils/thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Bulk, deterministic byte generation, from a seed, built on Ascon-CXOF128. Output is split into fixed-size streams, stream `i` being the output of
+// Ascon-CXOF128, customized with 64 -bit little-endian encoding of `i`, over the seed. As streams are independent, they are squeezed in parallel, using
+// multi-lane Ascon permutation and multiple threads, much like a block cipher in counter mode.
+namespace ascon_parallel_xof {
+
+// Each stream contributes these many bytes to the output, except the last one, which can be shorter.
+static constexpr size_t STREAM_BYTE_LEN = 8 * 1'024;
+
+// Computes Ascon-CXOF128 permutation state, customized with stream index and having absorbed the seed, ready to be squeezed for producing that stream.
+[[nodiscard]]
+forceinline constexpr ascon_perm::ascon_perm_t
+compute_stream_state(std::span<const uint8_t> seed, const uint64_t stream_idx)
+{
+  std::array<uint8_t, sizeof(stream_idx)> cust_str{};
+  ascon_common_utils::to_le_bytes(stream_idx, cust_str);
+
+  auto state = ascon_cxof128::INITIAL_PERMUTATION_STATE;
+  size_t offset = 0;
+
+  ascon_cxof128::absorb_customization_string(state, cust_str);
+
+  ascon_sponge_mode::absorb(state, offset, seed);
+  ascon_sponge_mode::finalize(state, offset);
+
+  return state;
+}
+
+/**
+ * @brief Fills output with pseudo-random bytes, deterministically derived from the seed. Output of given length is always the prefix of any longer output,
+ * for the same seed, irrespective of LANES and number of threads used. Streams are squeezed LANES at a time, using multi-lane Ascon permutation, on all
+ * threads of the pool.
+ *
+ * @param pool Thread pool, to run on.
+ * @param seed Seed, of arbitrary length.
+ * @param out Output, of arbitrary length, to be filled.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+inline void
+generate(ascon_parallel::thread_pool_t& pool, std::span<const uint8_t> seed, std::span<uint8_t> out)
+{
+  // Number of streams a thread picks up at once.
+  constexpr size_t STREAMS_PER_RANGE = LANES * 4;
+
+  const size_t num_streams = (out.size() + (STREAM_BYTE_LEN - 1)) / STREAM_BYTE_LEN;
+
+  pool.parallel_for(num_streams, STREAMS_PER_RANGE, [&](const size_t begin, const size_t end) {
+    std::array<ascon_perm::ascon_perm_t, STREAMS_PER_RANGE> states{};
+    std::array<std::span<uint8_t>, STREAMS_PER_RANGE> outs{};
+
+    for (size_t i = begin; i < end; i++) {
+      const size_t offset = i * STREAM_BYTE_LEN;
+
+      states[i - begin] = compute_stream_state(seed, i);
+      outs[i - begin] = out.subspan(offset, std::min(STREAM_BYTE_LEN, out.size() - offset));
+    }
+
+    ascon_sponge_mode::squeeze_many<LANES>(std::span(states).first(end - begin), std::span(outs).first(end - begin));
+  });
+}
+
+}
@@ -0,0 +1,354 @@
+#pragma once
+#include "ascon/hashes/ascon_cxof128.hpp"
+#include "ascon/hashes/sponge.hpp"
+#include "ascon/hashes/sponge_xN.hpp"
+#include "ascon/permutation/ascon_xN.hpp"
+#include "ascon/utils/thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+// Tree hashing mode, built on Ascon-CXOF128, for hashing large messages using many threads and SIMD lanes.
+//
+// Message is split into `CHUNK_BYTE_LEN` -bytes chunks (last one can be shorter, an empty message makes a single empty chunk), which are the leaves of a
+// left-balanced binary tree i.e. left subtree of any node covers the largest power of 2 -many chunks, strictly less than the total covered by that node.
+//
+// - Chaining value of a leaf is Ascon-CXOF128["leaf"](chunk).
+// - Chaining value of a parent is Ascon-CXOF128["node"](left chaining value || right chaining value).
+// - Output is Ascon-CXOF128["root"](le64(message byte length) || chaining value of tree root), of arbitrary length.
+//
+// All chaining values are `CHAINING_VALUE_BYTE_LEN` -bytes. Leaves and parents at the same level are independent of each other, so they are hashed in parallel.
+namespace ascon_tree_hash {
+
+static constexpr size_t CHUNK_BYTE_LEN = 8 * 1'024;
+static constexpr size_t CHAINING_VALUE_BYTE_LEN = 32;
+
+// A tree of at most 2^64 chunks can't be deeper than this, which bounds the stack of chaining values, incremental hasher keeps.
+static constexpr size_t MAX_TREE_DEPTH = 64;
+
+// Ascon-CXOF128 permutation states, right after being customized with "leaf", "node" and "root", so that hashing a node starts from them, instead of
+// absorbing the customization string all over again.
+static constexpr auto LEAF_INIT_STATE = ascon_cxof128::compute_prefix("leaf").permutation_state();
+static constexpr auto NODE_INIT_STATE = ascon_cxof128::compute_prefix("node").permutation_state();
+static constexpr auto ROOT_INIT_STATE = ascon_cxof128::compute_prefix("root").permutation_state();
+
+// Computes chaining value of a parent node, from chaining values of its children. Output can alias either of the inputs.
+forceinline constexpr void
+hash_parent(std::span<const uint8_t, CHAINING_VALUE_BYTE_LEN> left,
+            std::span<const uint8_t, CHAINING_VALUE_BYTE_LEN> right,
+            std::span<uint8_t, CHAINING_VALUE_BYTE_LEN> parent)
+{
+  auto state = NODE_INIT_STATE;
+  size_t offset = 0;
+  size_t readable = ascon_sponge_mode::RATE_BYTES;
+
+  ascon_sponge_mode::absorb(state, offset, left);
+  ascon_sponge_mode::absorb(state, offset, right);
+  ascon_sponge_mode::finalize(state, offset);
+  ascon_sponge_mode::squeeze(state, readable, parent);
+}
+
+// Absorbs byte length of the message and chaining value of tree root into the root Ascon-CXOF128 state, finalizing it, so that it's ready to be squeezed.
+forceinline constexpr void
+absorb_root(ascon_perm::ascon_perm_t& state, const uint64_t msg_byte_len, std::span<const uint8_t, CHAINING_VALUE_BYTE_LEN> root_cv)
+{
+  std::array<uint8_t, sizeof(msg_byte_len)> msg_byte_len_as_bytes{};
+  ascon_common_utils::to_le_bytes(msg_byte_len, msg_byte_len_as_bytes);
+
+  size_t offset = 0;
+
+  ascon_sponge_mode::absorb(state, offset, msg_byte_len_as_bytes);
+  ascon_sponge_mode::absorb(state, offset, root_cv);
+  ascon_sponge_mode::finalize(state, offset);
+}
+
+/// @brief Enumeration representing the status of Ascon tree hashing operations.
+enum class ascon_tree_hash_status_t : uint8_t
+{
+  /// @brief Data was successfully absorbed by the `absorb()` method.
+  absorbed_data = 0x01,
+
+  /// @brief The state is still in the data absorption phase; `finalize()` must be called before squeezing output.
+  still_in_data_absorption_phase,
+
+  /// @brief The data absorption phase was successfully finalized by the `finalize()` method.
+  finalized_data_absorption_phase,
+
+  /// @brief Attempted to absorb data or finalize after the data absorption phase was already finalized.
+  data_absorption_phase_already_finalized,
+
+  /// @brief Output data was successfully squeezed by the `squeeze()` method.
+  squeezed_output,
+};
+
+/**
+ * @brief Incremental Ascon tree hasher. Message can be absorbed in arbitrary sized pieces, chaining values of completed subtrees are kept on a stack and merged
+ * as soon as a subtree becomes complete, so memory use stays bounded, irrespective of message length. Whole chunks, found in a single call to `absorb`, are
+ * hashed together, using the multi-lane Ascon permutation. Produces same output as the one-shot, multi-threaded `hash`.
+ */
+struct ascon_tree_hash_t
+{
+private:
+  static constexpr size_t LANES = ascon_perm::NATIVE_LANE_COUNT;
+
+  ascon_perm::ascon_perm_t leaf_state = LEAF_INIT_STATE;
+  size_t leaf_offset = 0;
+  size_t leaf_byte_len = 0;
+
+  // Chaining value of a complete chunk, which is pushed onto the stack only when more data arrives, as the last chunk of the message is merged differently.
+  std::array<uint8_t, CHAINING_VALUE_BYTE_LEN> pending_cv{};
+  alignas(4) bool has_pending_cv = false;
+
+  std::array<std::array<uint8_t, CHAINING_VALUE_BYTE_LEN>, MAX_TREE_DEPTH> cv_stack{};
+  size_t cv_stack_len = 0;
+  uint64_t num_completed_chunks = 0;
+  uint64_t total_byte_len = 0;
+
+  ascon_perm::ascon_perm_t root_state = ROOT_INIT_STATE;
+  size_t readable = 0;
+  alignas(4) bool finished_absorbing = false;
+
+  // Pushes chaining value of a completed chunk onto the stack, after merging it with chaining values of all those subtrees, which it completes.
+  forceinline constexpr void push_chunk_cv(std::span<const uint8_t, CHAINING_VALUE_BYTE_LEN> chunk_cv)
+  {
+    std::array<uint8_t, CHAINING_VALUE_BYTE_LEN> cv{};
+    std::copy(chunk_cv.begin(), chunk_cv.end(), cv.begin());
+
+    num_completed_chunks++;
+
+    for (uint64_t count = num_completed_chunks; (count & 1) == 0; count >>= 1) {
+      hash_parent(cv_stack[--cv_stack_len], cv, cv);
+    }
+
+    cv_stack[cv_stack_len++] = cv;
+  }
+
+  // Finalizes the chunk being hashed, writing its chaining value, and resets leaf state for next chunk.
+  forceinline constexpr void finish_leaf(std::span<uint8_t, CHAINING_VALUE_BYTE_LEN> cv)
+  {
+    size_t leaf_readable = ascon_sponge_mode::RATE_BYTES;
+
+    ascon_sponge_mode::finalize(leaf_state, leaf_offset);
+    ascon_sponge_mode::squeeze(leaf_state, leaf_readable, cv);
+
+    leaf_state = LEAF_INIT_STATE;
+    leaf_offset = 0;
+    leaf_byte_len = 0;
+  }
+
+public:
+  // Constructor(s)/ Destructor(s)
+  forceinline constexpr ascon_tree_hash_t() = default;
+  forceinline constexpr ~ascon_tree_hash_t()
+  {
+    leaf_state.reset();
+    root_state.reset();
+    pending_cv.fill(0);
+    for (auto& cv : cv_stack) {
+      cv.fill(0);
+    }
+
+    leaf_offset = 0;
+    leaf_byte_len = 0;
+    has_pending_cv = false;
+    cv_stack_len = 0;
+    num_completed_chunks = 0;
+    total_byte_len = 0;
+    readable = 0;
+    finished_absorbing = false;
+  }
+
+  /**
+   * @brief Absorbs input data into the tree hasher. This function can be called repeatedly to absorb data in chunks before calling `finalize()`.
+   * @param msg The data to absorb.
+   * @return An `ascon_tree_hash_status_t` indicating the result of the operation.
+   *   - `ascon_tree_hash_status_t::absorbed_data`: Data was successfully absorbed.
+   *   - `ascon_tree_hash_status_t::data_absorption_phase_already_finalized`: Data absorption phase was already finalized.
+   */
+  [[nodiscard]]
+  forceinline constexpr ascon_tree_hash_status_t absorb(std::span<const uint8_t> msg)
+  {
+    if (finished_absorbing) {
+      return ascon_tree_hash_status_t::data_absorption_phase_already_finalized;
+    }
+
+    total_byte_len += msg.size();
+
+    while (!msg.empty()) {
+      if (has_pending_cv) {
+        push_chunk_cv(pending_cv);
+        has_pending_cv = false;
+      }
+
+      // Whole chunks are hashed LANES at a time, directly from the message.
+      if ((leaf_byte_len == 0) && (msg.size() >= CHUNK_BYTE_LEN)) {
+        std::array<std::span<const uint8_t>, LANES> chunks{};
+        std::array<std::array<uint8_t, CHAINING_VALUE_BYTE_LEN>, LANES> cvs{};
+
+        const size_t num_chunks = msg.size() / CHUNK_BYTE_LEN;
+
+        for (size_t off = 0; off < num_chunks; off += LANES) {
+          const size_t num_lanes = std::min(LANES, num_chunks - off);
+
+          for (size_t lane = 0; lane < num_lanes; lane++) {
+            chunks[lane] = msg.subspan((off + lane) * CHUNK_BYTE_LEN, CHUNK_BYTE_LEN);
+          }
+
+          ascon_sponge_mode::absorb_and_squeeze_many<CHAINING_VALUE_BYTE_LEN, LANES>(
+            LEAF_INIT_STATE, std::span(chunks).first(num_lanes), std::span(cvs).first(num_lanes));
+
+          for (size_t lane = 0; lane < num_lanes; lane++) {
+            if ((off + lane + 1) == num_chunks) {
+              pending_cv = cvs[lane];
+              has_pending_cv = true;
+            } else {
+              push_chunk_cv(cvs[lane]);
+            }
+          }
+        }
+
+        msg = msg.subspan(num_chunks * CHUNK_BYTE_LEN);
+        continue;
+      }
+
+      const size_t to_be_absorbed_num_bytes = std::min(CHUNK_BYTE_LEN - leaf_byte_len, msg.size());
+
+      ascon_sponge_mode::absorb(leaf_state, leaf_offset, msg.first(to_be_absorbed_num_bytes));
+      leaf_byte_len += to_be_absorbed_num_bytes;
+
+      msg = msg.subspan(to_be_absorbed_num_bytes);
+
+      if (leaf_byte_len == CHUNK_BYTE_LEN) {
+        finish_leaf(pending_cv);
+        has_pending_cv = true;
+      }
+    }
+
+    return ascon_tree_hash_status_t::absorbed_data;
+  }
+
+  /**
+   * @brief Completes the absorption phase, merging chaining values of the last chunk and all pending subtrees into the chaining value of tree root, which is
+   * absorbed into the root state, along with message length. It prepares the internal state for the squeezing operation.
+   * @return An `ascon_tree_hash_status_t` indicating the result of the operation.
+   *   - `ascon_tree_hash_status_t::finalized_data_absorption_phase`: The state was successfully finalized.
+   *   - `ascon_tree_hash_status_t::data_absorption_phase_already_finalized`: The state was already finalized.
+   */
+  [[nodiscard]]
+  forceinline constexpr ascon_tree_hash_status_t finalize()
+  {
+    if (finished_absorbing) {
+      return ascon_tree_hash_status_t::data_absorption_phase_already_finalized;
+    }
+
+    // Last chunk is either already hashed, when it's complete, or it's being hashed, otherwise. An empty message makes a single empty chunk.
+    std::array<uint8_t, CHAINING_VALUE_BYTE_LEN> cv{};
+    if (has_pending_cv) {
+      cv = pending_cv;
+    } else {
+      finish_leaf(cv);
+    }
+
+    while (cv_stack_len > 0) {
+      hash_parent(cv_stack[--cv_stack_len], cv, cv);
+    }
+
+    absorb_root(root_state, total_byte_len, cv);
+
+    finished_absorbing = true;
+    readable = ascon_sponge_mode::RATE_BYTES;
+
+    return ascon_tree_hash_status_t::finalized_data_absorption_phase;
+  }
+
+  /**
+   * @brief Extracts output data from the finalized tree hasher. This function can be called multiple times to generate an arbitrary amount of output data.
+   * The `finalize` method must be called before the first call to this function.
+   * @param out The buffer to write the squeezed data to.
+   * @return An `ascon_tree_hash_status_t` indicating the result of the operation.
+   *   - `ascon_tree_hash_status_t::squeezed_output`: Output was successfully squeezed.
+   *   - `ascon_tree_hash_status_t::still_in_data_absorption_phase`: State is not yet finalized.
+   */
+  [[nodiscard]]
+  forceinline constexpr ascon_tree_hash_status_t squeeze(std::span<uint8_t> out)
+  {
+    if (!finished_absorbing) {
+      return ascon_tree_hash_status_t::still_in_data_absorption_phase;
+    }
+
+    ascon_sponge_mode::squeeze(root_state, readable, out);
+    return ascon_tree_hash_status_t::squeezed_output;
+  }
+};
+
+/**
+ * @brief One-shot Ascon tree hashing of a message, which is available in full. All leaves are hashed in parallel, using all threads of the pool and LANES -wide
+ * multi-lane Ascon permutation on each, followed by hashing of parents, level by level, pairing adjacent nodes and carrying the odd one out to the next
+ * level - which yields the same left-balanced tree, incremental `ascon_tree_hash_t` builds.
+ *
+ * @param pool Thread pool, to run on.
+ * @param msg Message to be hashed.
+ * @param out Output, of arbitrary length, to be squeezed.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+inline void
+hash(ascon_parallel::thread_pool_t& pool, std::span<const uint8_t> msg, std::span<uint8_t> out)
+{
+  // Number of nodes a thread picks up at once, large enough to amortize the cost of picking up work, small enough to balance load across threads.
+  constexpr size_t LEAVES_PER_RANGE = LANES * 4;
+  constexpr size_t PARENTS_PER_RANGE = LANES * 64;
+
+  const size_t num_leaves = std::max<size_t>((msg.size() + (CHUNK_BYTE_LEN - 1)) / CHUNK_BYTE_LEN, 1);
+  std::vector<std::array<uint8_t, CHAINING_VALUE_BYTE_LEN>> cvs(num_leaves);
+
+  pool.parallel_for(num_leaves, LEAVES_PER_RANGE, [&](const size_t begin, const size_t end) {
+    std::array<std::span<const uint8_t>, LEAVES_PER_RANGE> chunks{};
+
+    for (size_t i = begin; i < end; i++) {
+      const size_t offset = i * CHUNK_BYTE_LEN;
+      chunks[i - begin] = msg.subspan(offset, std::min(CHUNK_BYTE_LEN, msg.size() - offset));
+    }
+
+    ascon_sponge_mode::absorb_and_squeeze_many<CHAINING_VALUE_BYTE_LEN, LANES>(
+      LEAF_INIT_STATE, std::span(chunks).first(end - begin), std::span(cvs).subspan(begin, end - begin));
+  });
+
+  while (cvs.size() > 1) {
+    const size_t num_parents = cvs.size() / 2;
+
+    std::vector<uint8_t> children(num_parents * 2 * CHAINING_VALUE_BYTE_LEN);
+    std::vector<std::span<const uint8_t>> nodes(num_parents);
+    std::vector<std::array<uint8_t, CHAINING_VALUE_BYTE_LEN>> parent_cvs(num_parents + (cvs.size() & 1));
+
+    pool.parallel_for(num_parents, PARENTS_PER_RANGE, [&](const size_t begin, const size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        auto node = std::span(children).subspan(i * 2 * CHAINING_VALUE_BYTE_LEN, 2 * CHAINING_VALUE_BYTE_LEN);
+
+        std::copy(cvs[2 * i].begin(), cvs[2 * i].end(), node.begin());
+        std::copy(cvs[2 * i + 1].begin(), cvs[2 * i + 1].end(), node.begin() + CHAINING_VALUE_BYTE_LEN);
+
+        nodes[i] = node;
+      }
+
+      ascon_sponge_mode::absorb_and_squeeze_many<CHAINING_VALUE_BYTE_LEN, LANES>(
+        NODE_INIT_STATE, std::span(nodes).subspan(begin, end - begin), std::span(parent_cvs).subspan(begin, end - begin));
+    });
+
+    if ((cvs.size() & 1) == 1) {
+      parent_cvs.back() = cvs.back();
+    }
+
+    cvs = std::move(parent_cvs);
+  }
+
+  auto root_state = ROOT_INIT_STATE;
+  size_t readable = ascon_sponge_mode::RATE_BYTES;
+
+  absorb_root(root_state, msg.size(), cvs.front());
+  ascon_sponge_mode::squeeze(root_state, readable, out);
+}
+
+}
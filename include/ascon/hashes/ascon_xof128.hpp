@@ -1,5 +1,6 @@
 #pragma once
 #include "ascon/hashes/sponge.hpp"
+#include "ascon/utils/tracing.hpp"
 
 namespace ascon_xof128 {
 
@@ -68,6 +69,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_xof128_status_t absorb(std::span<const uint8_t> msg)
   {
+    ASCON_TRACE_SCOPE(xof128_absorb, msg.size());
+
     if (finished_absorbing) {
       return ascon_xof128_status_t::data_absorption_phase_already_finalized;
     }
@@ -86,6 +89,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_xof128_status_t finalize()
   {
+    ASCON_TRACE_SCOPE(xof128_finalize, 0);
+
     if (finished_absorbing) {
       return ascon_xof128_status_t::data_absorption_phase_already_finalized;
     }
@@ -109,6 +114,8 @@ public:
   [[nodiscard]]
   forceinline constexpr ascon_xof128_status_t squeeze(std::span<uint8_t> out)
   {
+    ASCON_TRACE_SCOPE(xof128_squeeze, out.size());
+
     if (!finished_absorbing) {
       return ascon_xof128_status_t::still_in_data_absorption_phase;
     }
@@ -118,4 +125,27 @@ public:
   }
 };
 
+/**
+ * @brief Computes Ascon-XOF128 output, of length known during program compilation, over a message, whose length is also known during program compilation.
+ * Message blocks are absorbed, and output is squeezed, in loops of compile-time known trip count, skipping the offset bookkeeping and partial block
+ * handling of `ascon_xof128_t`. Produces same output as `ascon_xof128_t`.
+ *
+ * @param msg Message of MSG_BYTE_LEN -bytes, to be absorbed.
+ * @param out A span of OUT_BYTE_LEN -bytes, where the output will be written.
+ */
+template<const size_t MSG_BYTE_LEN, const size_t OUT_BYTE_LEN>
+forceinline constexpr void
+xof(std::span<const uint8_t, MSG_BYTE_LEN> msg, std::span<uint8_t, OUT_BYTE_LEN> out)
+  requires((MSG_BYTE_LEN != std::dynamic_extent) && (OUT_BYTE_LEN != std::dynamic_extent))
+{
+  ASCON_TRACE_SCOPE(xof128_xof, MSG_BYTE_LEN + OUT_BYTE_LEN);
+
+  auto state = INITIAL_PERMUTATION_STATE;
+
+  ascon_sponge_mode::absorb_and_finalize(state, msg);
+  ascon_sponge_mode::squeeze_all(state, out);
+
+  state.reset();
+}
+
 }
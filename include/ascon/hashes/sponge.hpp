@@ -2,6 +2,7 @@
 #include "ascon/permutation/ascon.hpp"
 #include "ascon/utils/common.hpp"
 #include "ascon/utils/force_inline.hpp"
+#include "ascon/utils/instrumentation.hpp"
 #include <algorithm>
 #include <array>
 #include <cstdint>
@@ -19,13 +20,15 @@ consteval ascon_perm::ascon_perm_t
 compute_init_state(const uint64_t iv)
 {
   ascon_perm::ascon_perm_t state({ iv, 0, 0, 0, 0 });
-  state.permute<12>();
+  state.template permute<12>();
   return state;
 }
 
-// Absorbs an arbitrary-length message into the permutation state. Can be called multiple times before finalization.
+// Absorbs an arbitrary-length message into the permutation state. Can be called multiple times before finalization. Full message blocks are loaded directly
+// from the message, only the partial blocks at its head (when previous call left a partially absorbed block) and tail are staged.
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-absorb(ascon_perm::ascon_perm_t& state,
+absorb(perm_t& state,
        size_t& block_offset, // Denotes how many bytes were already absorbed into the RATE portion of state, without permuting it.
        std::span<const uint8_t> msg)
 {
@@ -34,45 +37,66 @@ absorb(ascon_perm::ascon_perm_t& state,
   std::array<uint8_t, RATE_BYTES> block{};
   auto block_span = std::span(block);
 
-  const size_t total_num_blocks = (block_offset + mlen) / RATE_BYTES;
   size_t msg_offset = 0;
+  size_t num_partial_blocks = 0;
 
-  for (size_t block_index = 0; block_index < total_num_blocks; block_index++) {
-    const size_t readable = RATE_BYTES - block_offset;
+  // Head, completing a partially absorbed block, if any
+  if (block_offset > 0) {
+    const size_t to_be_absorbed_num_bytes = std::min(RATE_BYTES - block_offset, mlen);
 
-    std::copy_n(msg.subspan(msg_offset).begin(), readable, block_span.subspan(block_offset).begin());
-    state[0] ^= ascon_common_utils::from_le_bytes(block_span);
+    std::copy_n(msg.begin(), to_be_absorbed_num_bytes, block_span.subspan(block_offset).begin());
+    state.xor_word(0, ascon_common_utils::from_le_bytes(block_span));
 
-    state.permute<ASCON_PERM_NUM_ROUNDS>();
+    msg_offset += to_be_absorbed_num_bytes;
+    block_offset += to_be_absorbed_num_bytes;
+    num_partial_blocks += (to_be_absorbed_num_bytes > 0);
 
-    msg_offset += readable;
-    block_offset = 0;
+    if (block_offset == RATE_BYTES) {
+      state.template permute<ASCON_PERM_NUM_ROUNDS>();
+      block_offset = 0;
+    }
+  }
+
+  // Full blocks, read directly from message
+  const size_t num_full_blocks = (mlen - msg_offset) / RATE_BYTES;
+  while ((mlen - msg_offset) >= RATE_BYTES) {
+    state.xor_word(0, ascon_common_utils::load_le_u64(msg.subspan(msg_offset).first<RATE_BYTES>()));
+    state.template permute<ASCON_PERM_NUM_ROUNDS>();
+
+    msg_offset += RATE_BYTES;
   }
 
+  // Tail, a partial block, only if head didn't already consume the whole message
   const size_t remaining_num_bytes = mlen - msg_offset;
+  if (remaining_num_bytes > 0) {
+    std::fill(block_span.begin(), block_span.end(), 0x00);
+    std::copy_n(msg.subspan(msg_offset).begin(), remaining_num_bytes, block_span.begin());
 
-  std::fill(block_span.begin(), block_span.end(), 0x00);
-  std::copy_n(msg.subspan(msg_offset).begin(), remaining_num_bytes, block_span.subspan(block_offset).begin());
+    state.xor_word(0, ascon_common_utils::from_le_bytes(block_span));
+    block_offset += remaining_num_bytes;
+    num_partial_blocks++;
+  }
 
-  state[0] ^= ascon_common_utils::from_le_bytes(block_span);
-  block_offset += remaining_num_bytes;
+  ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::hash_absorb, num_full_blocks, num_partial_blocks, mlen);
 }
 
 // Finalizes the internal state after absorbing all input messages, preparing it for squeezing.
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-finalize(ascon_perm::ascon_perm_t& state, size_t& block_offset)
+finalize(perm_t& state, size_t& block_offset)
 {
-  const auto pad_mask = 0x01ul << (block_offset * std::numeric_limits<uint8_t>::digits);
+  const auto pad_mask = uint64_t{ 0x01 } << (block_offset * std::numeric_limits<uint8_t>::digits);
 
-  state[0] ^= pad_mask;
-  state.permute<ASCON_PERM_NUM_ROUNDS>();
+  state.xor_word(0, pad_mask);
+  state.template permute<ASCON_PERM_NUM_ROUNDS>();
 
   block_offset = 0;
 }
 
 // Extracts an arbitrary-length output from the finalized permutation state. Multiple calls are permitted.
+template<ascon_perm::ascon_perm_state perm_t>
 forceinline constexpr void
-squeeze(ascon_perm::ascon_perm_t& state, size_t& num_squeezable_bytes, std::span<uint8_t> out)
+squeeze(perm_t& state, size_t& num_squeezable_bytes, std::span<uint8_t> out)
 {
   const size_t olen = out.size();
 
@@ -90,11 +114,75 @@ squeeze(ascon_perm::ascon_perm_t& state, size_t& num_squeezable_bytes, std::span
     num_squeezable_bytes -= to_be_squeezed_num_bytes;
     out_offset += to_be_squeezed_num_bytes;
 
+    const bool is_full_block = to_be_squeezed_num_bytes == RATE_BYTES;
+    ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::hash_squeeze, is_full_block, !is_full_block, to_be_squeezed_num_bytes);
+
     if (num_squeezable_bytes == 0) {
-      state.permute<ASCON_PERM_NUM_ROUNDS>();
+      state.template permute<ASCON_PERM_NUM_ROUNDS>();
       num_squeezable_bytes = RATE_BYTES;
     }
   }
 }
 
+// Absorbs a message of compile-time known length, into freshly initialized permutation state, finalizing it. Number of message blocks, and position of the
+// padding, are both resolved during program compilation, so that full blocks are absorbed in a loop of fixed trip count, without any offset bookkeeping,
+// while the tail is handled without branching on its length. The loop is deliberately not unrolled by hand, as each iteration inlines a whole permutation.
+template<const size_t MSG_BYTE_LEN, ascon_perm::ascon_perm_state perm_t>
+forceinline constexpr void
+absorb_and_finalize(perm_t& state, std::span<const uint8_t, MSG_BYTE_LEN> msg)
+{
+  constexpr size_t NUM_FULL_BLOCKS = MSG_BYTE_LEN / RATE_BYTES;
+  constexpr size_t TAIL_BYTE_LEN = MSG_BYTE_LEN % RATE_BYTES;
+
+  for (size_t i = 0; i < NUM_FULL_BLOCKS; i++) {
+    state.xor_word(0, ascon_common_utils::load_le_u64(msg.subspan(i * RATE_BYTES).template first<RATE_BYTES>()));
+    state.template permute<ASCON_PERM_NUM_ROUNDS>();
+  }
+
+  // Tail, a partial block, if any, along with padding
+  auto last_word = uint64_t{ 0x01 } << (TAIL_BYTE_LEN * std::numeric_limits<uint8_t>::digits);
+  if constexpr (TAIL_BYTE_LEN > 0) {
+    std::array<uint8_t, RATE_BYTES> block{};
+    std::copy_n(msg.template last<TAIL_BYTE_LEN>().begin(), TAIL_BYTE_LEN, block.begin());
+
+    last_word ^= ascon_common_utils::from_le_bytes(block);
+  }
+
+  state.xor_word(0, last_word);
+  state.template permute<ASCON_PERM_NUM_ROUNDS>();
+
+  ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::hash_absorb, NUM_FULL_BLOCKS, TAIL_BYTE_LEN > 0, MSG_BYTE_LEN);
+}
+
+// Extracts output of compile-time known length, from the finalized permutation state, full blocks in a loop of fixed trip count, followed by the tail, if
+// any. Unlike `squeeze`, it's meant to be called only once, so the permutation is not applied after extracting the last block.
+template<const size_t OUT_BYTE_LEN, ascon_perm::ascon_perm_state perm_t>
+forceinline constexpr void
+squeeze_all(perm_t& state, std::span<uint8_t, OUT_BYTE_LEN> out)
+{
+  constexpr size_t NUM_FULL_BLOCKS = OUT_BYTE_LEN / RATE_BYTES;
+  constexpr size_t TAIL_BYTE_LEN = OUT_BYTE_LEN % RATE_BYTES;
+
+  for (size_t i = 0; i < NUM_FULL_BLOCKS; i++) {
+    if (i > 0) {
+      state.template permute<ASCON_PERM_NUM_ROUNDS>();
+    }
+
+    ascon_common_utils::store_le_u64(state[0], out.subspan(i * RATE_BYTES).template first<RATE_BYTES>());
+  }
+
+  if constexpr (TAIL_BYTE_LEN > 0) {
+    if constexpr (NUM_FULL_BLOCKS > 0) {
+      state.template permute<ASCON_PERM_NUM_ROUNDS>();
+    }
+
+    std::array<uint8_t, RATE_BYTES> block{};
+    ascon_common_utils::to_le_bytes(state[0], block);
+
+    std::copy_n(block.begin(), TAIL_BYTE_LEN, out.template last<TAIL_BYTE_LEN>().begin());
+  }
+
+  ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::hash_squeeze, OUT_BYTE_LEN / RATE_BYTES, (OUT_BYTE_LEN % RATE_BYTES) > 0, OUT_BYTE_LEN);
+}
+
 }
@@ -0,0 +1,169 @@
+#pragma once
+#include "ascon/hashes/sponge.hpp"
+#include "ascon/permutation/ascon.hpp"
+#include "ascon/permutation/ascon_xN.hpp"
+#include "ascon/utils/common.hpp"
+#include "ascon/utils/force_inline.hpp"
+#include "ascon/utils/instrumentation.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace ascon_sponge_mode {
+
+/**
+ * @brief Computes OUT_LEN -bytes output of Ascon sponge for each of many independent messages, interleaving LANES sponge states through the multi-lane
+ * Ascon permutation. Each lane walks through its own message - absorbing full blocks, absorbing the padded last block and then squeezing output words, one
+ * step per permutation call. Messages are of arbitrary, ragged lengths; as soon as a lane finishes with its message, it picks up the next message from the
+ * batch, while idle lanes are masked i.e. their permutation output is simply ignored, and they are not counted by instrumentation.
+ *
+ * @param init_state Permutation state to start each message with e.g. initial permutation state of Ascon-Hash256.
+ * @param msgs Messages to be absorbed.
+ * @param outs Sponge outputs, one for each message, must be of same length as `msgs`.
+ */
+template<const size_t OUT_LEN, const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+forceinline constexpr void
+absorb_and_squeeze_many(const ascon_perm::ascon_perm_t& init_state,
+                        std::span<const std::span<const uint8_t>> msgs,
+                        std::span<std::array<uint8_t, OUT_LEN>> outs)
+  requires(OUT_LEN > 0)
+{
+  constexpr size_t NUM_OUT_WORDS = (OUT_LEN + (RATE_BYTES - 1)) / RATE_BYTES;
+  constexpr size_t IDLE_LANE = std::numeric_limits<size_t>::max();
+
+  ascon_perm::ascon_perm_xN_t<LANES> state;
+
+  std::array<size_t, LANES> lane_msg_idx{};
+  std::array<size_t, LANES> lane_step{};
+  lane_msg_idx.fill(IDLE_LANE);
+
+  std::array<uint8_t, RATE_BYTES> block{};
+  auto block_span = std::span(block);
+
+  size_t next_msg_idx = 0;
+
+  while (true) {
+    size_t num_active_lanes = 0;
+
+    for (size_t lane = 0; lane < LANES; lane++) {
+      while (true) {
+        if (lane_msg_idx[lane] == IDLE_LANE) {
+          if (next_msg_idx == msgs.size()) {
+            break;
+          }
+
+          state.set_lane(lane, init_state);
+          lane_msg_idx[lane] = next_msg_idx++;
+          lane_step[lane] = 0;
+        }
+
+        const auto msg = msgs[lane_msg_idx[lane]];
+        const size_t num_full_blocks = msg.size() / RATE_BYTES;
+        const size_t step = lane_step[lane]++;
+
+        if (step < num_full_blocks) {
+          // Absorb a full message block.
+          state(0, lane) ^= ascon_common_utils::from_le_bytes(msg.subspan(step * RATE_BYTES).template first<RATE_BYTES>());
+        } else if (step == num_full_blocks) {
+          // Absorb last, padded message block.
+          const size_t remaining_num_bytes = msg.size() - step * RATE_BYTES;
+
+          std::fill(block_span.begin(), block_span.end(), 0x00);
+          std::copy_n(msg.subspan(step * RATE_BYTES).begin(), remaining_num_bytes, block_span.begin());
+          block_span[remaining_num_bytes] = 0x01;
+
+          state(0, lane) ^= ascon_common_utils::from_le_bytes(block_span);
+          ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::hash_absorb, num_full_blocks, remaining_num_bytes > 0, msg.size());
+        } else {
+          // Squeeze an output word.
+          const size_t word_idx = step - (num_full_blocks + 1);
+          const size_t out_offset = word_idx * RATE_BYTES;
+          const size_t to_be_squeezed_num_bytes = std::min(RATE_BYTES, OUT_LEN - out_offset);
+
+          ascon_common_utils::to_le_bytes(state(0, lane), block_span);
+          std::copy_n(block_span.begin(), to_be_squeezed_num_bytes, outs[lane_msg_idx[lane]].begin() + out_offset);
+
+          if (word_idx + 1 == NUM_OUT_WORDS) {
+            // Done with this message, no need to permute, try to pick up next one.
+            ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::hash_squeeze, OUT_LEN / RATE_BYTES, (OUT_LEN % RATE_BYTES) > 0, OUT_LEN);
+            lane_msg_idx[lane] = IDLE_LANE;
+            continue;
+          }
+        }
+
+        num_active_lanes++;
+        break;
+      }
+    }
+
+    if (num_active_lanes == 0) {
+      break;
+    }
+
+    state.template permute<ASCON_PERM_NUM_ROUNDS>(num_active_lanes);
+  }
+}
+
+/**
+ * @brief Squeezes output of arbitrary length from each of many independent, already finalized, Ascon sponge states, interleaving LANES of them through the
+ * multi-lane Ascon permutation. States are taken up in groups of LANES, each group is squeezed till its longest output is filled, shorter outputs simply stop
+ * being written to. Output of each state is same as what `squeeze` would produce, when called on it.
+ *
+ * @param states Finalized permutation states, ready to be squeezed.
+ * @param outs Outputs, one for each state, must be of same length as `states`.
+ */
+template<const size_t LANES = ascon_perm::NATIVE_LANE_COUNT>
+forceinline constexpr void
+squeeze_many(std::span<const ascon_perm::ascon_perm_t> states, std::span<const std::span<uint8_t>> outs)
+{
+  ascon_perm::ascon_perm_xN_t<LANES> state;
+
+  std::array<uint8_t, RATE_BYTES> block{};
+  auto block_span = std::span(block);
+
+  for (size_t base = 0; base < states.size(); base += LANES) {
+    const size_t num_lanes = std::min(LANES, states.size() - base);
+
+    size_t max_out_len = 0;
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      const size_t out_len = outs[base + lane].size();
+
+      state.set_lane(lane, states[base + lane]);
+      max_out_len = std::max(max_out_len, out_len);
+
+      ascon_instrumentation::record_blocks(ascon_instrumentation::phase_t::hash_squeeze, out_len / RATE_BYTES, (out_len % RATE_BYTES) > 0, out_len);
+    }
+
+    for (size_t out_offset = 0; out_offset < max_out_len; out_offset += RATE_BYTES) {
+      if (out_offset > 0) {
+        // Only lanes, which still have output to be squeezed, need the permutation.
+        size_t num_active_lanes = 0;
+        for (size_t lane = 0; lane < num_lanes; lane++) {
+          num_active_lanes += out_offset < outs[base + lane].size();
+        }
+
+        state.template permute<ASCON_PERM_NUM_ROUNDS>(num_active_lanes);
+      }
+
+      for (size_t lane = 0; lane < num_lanes; lane++) {
+        const auto out = outs[base + lane];
+        if (out_offset >= out.size()) {
+          continue;
+        }
+
+        const size_t to_be_squeezed_num_bytes = std::min(RATE_BYTES, out.size() - out_offset);
+        if (to_be_squeezed_num_bytes == RATE_BYTES) {
+          ascon_common_utils::store_le_u64(state(0, lane), out.subspan(out_offset).template first<RATE_BYTES>());
+        } else {
+          ascon_common_utils::to_le_bytes(state(0, lane), block_span);
+          std::copy_n(block_span.begin(), to_be_squeezed_num_bytes, out.subspan(out_offset).begin());
+        }
+      }
+    }
+  }
+}
+
+}
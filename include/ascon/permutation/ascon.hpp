@@ -1,15 +1,28 @@
 #pragma once
 #include "ascon/utils/force_inline.hpp"
+#include "ascon/utils/instrumentation.hpp"
 #include <array>
 #include <bit>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
+
+// Define `ASCON_PERM_SINGLE_STATE_AVX512` to compute permutation of `ascon_perm_u64_t` using AVX-512, keeping whole state in a single register, instead of
+// scalar instructions. Whole program must be targeting AVX-512 then, so that it's inlined into the modes.
+#if defined(ASCON_PERM_SINGLE_STATE_AVX512)
+#if !defined(__AVX512F__)
+#error "ASCON_PERM_SINGLE_STATE_AVX512 requires an AVX-512F target e.g. -mavx512f or -march=native on a CPU supporting it"
+#endif
+#include "ascon/permutation/backends/avx512_single.hpp"
+#endif
 
 // Ascon Permutation.
 namespace ascon_perm {
 
 static constexpr size_t ASCON_PERMUTATION_MAX_ROUNDS = 16;
+static_assert(ASCON_PERMUTATION_MAX_ROUNDS == ascon_instrumentation::MAX_ROUNDS);
 static constexpr size_t PERMUTATION_STATE_BITWIDTH = 320;
 static constexpr size_t PERMUTATION_STATE_WORD_BITWIDTH = std::numeric_limits<uint64_t>::digits;
 static constexpr size_t PERMUTATION_STATE_WORD_COUNT = PERMUTATION_STATE_BITWIDTH / PERMUTATION_STATE_WORD_BITWIDTH;
@@ -18,8 +31,9 @@ static constexpr size_t PERMUTATION_STATE_WORD_COUNT = PERMUTATION_STATE_BITWIDT
 static constexpr std::array<uint8_t, ASCON_PERMUTATION_MAX_ROUNDS> ASCON_PERMUTATION_ROUND_CONSTANTS{ 0x3c, 0x2d, 0x1e, 0x0f, 0xf0, 0xe1, 0xd2, 0xc3,
                                                                                                       0xb4, 0xa5, 0x96, 0x87, 0x78, 0x69, 0x5a, 0x4b };
 
-// 320 -bit Ascon permutation state, on which we can apply n (<=16) -rounds permutation instance.
-struct ascon_perm_t
+// 320 -bit Ascon permutation state, on which we can apply n (<=16) -rounds permutation instance. State is kept as five 64 -bit words, which is the natural
+// representation on 64 -bit targets.
+struct ascon_perm_u64_t
 {
 private:
   // 320 -bit Ascon permutation state.
@@ -76,13 +90,13 @@ private:
 
 public:
   // Constructor(s)/ Destructor(s)
-  forceinline constexpr ascon_perm_t() = default;
-  forceinline constexpr ~ascon_perm_t() { reset(); }
+  forceinline constexpr ascon_perm_u64_t() = default;
+  forceinline constexpr ~ascon_perm_u64_t() { reset(); }
 
-  forceinline constexpr ascon_perm_t(std::array<uint64_t, 5>& words) { state = words; }
-  forceinline constexpr ascon_perm_t(std::array<uint64_t, 5>&& words) { state = words; }
-  forceinline constexpr ascon_perm_t(const std::array<uint64_t, 5>& words) { state = words; }
-  forceinline constexpr ascon_perm_t(const std::array<uint64_t, 5>&& words) { state = words; }
+  forceinline constexpr ascon_perm_u64_t(std::array<uint64_t, 5>& words) { state = words; }
+  forceinline constexpr ascon_perm_u64_t(std::array<uint64_t, 5>&& words) { state = words; }
+  forceinline constexpr ascon_perm_u64_t(const std::array<uint64_t, 5>& words) { state = words; }
+  forceinline constexpr ascon_perm_u64_t(const std::array<uint64_t, 5>&& words) { state = words; }
 
   // Accessor(s)
   [[nodiscard]]
@@ -96,6 +110,29 @@ public:
     return state[idx];
   }
 
+  // Overwrites/ XORs into a 64 -bit word of the state. Modes use these, instead of mutable indexing, so that they work with any state representation.
+  forceinline constexpr void set_word(const size_t idx, const uint64_t word) { state[idx] = word; }
+  forceinline constexpr void xor_word(const size_t idx, const uint64_t word) { state[idx] ^= word; }
+
+  // State representation trait; see `ascon_perm_state`. Words are kept as they are.
+  [[nodiscard]]
+  forceinline static constexpr uint64_t to_native(const uint64_t word)
+  {
+    return word;
+  }
+  [[nodiscard]]
+  forceinline static constexpr uint64_t from_native(const uint64_t word)
+  {
+    return word;
+  }
+  [[nodiscard]]
+  forceinline constexpr uint64_t native_word(const size_t idx) const
+  {
+    return state[idx];
+  }
+  forceinline constexpr void set_native_word(const size_t idx, const uint64_t word) { state[idx] = word; }
+  forceinline constexpr void xor_native_word(const size_t idx, const uint64_t word) { state[idx] ^= word; }
+
   [[nodiscard]]
   forceinline constexpr std::array<uint64_t, 5> reveal() const
   {
@@ -109,6 +146,14 @@ public:
     requires(R <= ASCON_PERMUTATION_MAX_ROUNDS)
   {
     constexpr size_t BEG = ASCON_PERMUTATION_MAX_ROUNDS - R;
+    ascon_instrumentation::record_permutation<R>();
+
+#if defined(ASCON_PERM_SINGLE_STATE_AVX512)
+    if (!std::is_constant_evaluated()) {
+      ascon_perm_avx512::permute_single<R>(state, ASCON_PERMUTATION_ROUND_CONSTANTS);
+      return;
+    }
+#endif
 
     if constexpr (R % 2 == 0) {
       for (size_t i = BEG; i < ASCON_PERMUTATION_MAX_ROUNDS; i += 2) {
@@ -123,4 +168,241 @@ public:
   }
 };
 
+// Splits a 64 -bit word into its even and odd bits, returning a 64 -bit word, whose low 32 -bits are the even bits and high 32 -bits are the odd bits, of the
+// original word. Bits are moved around using delta swaps; see https://github.com/ascon/ascon-c/blob/0ac4f8b8/crypto_aead/asconaead128/bi32/interleave.h.
+forceinline constexpr uint64_t
+bit_interleave(const uint64_t word)
+{
+  auto unzip = [](uint32_t x) {
+    uint32_t t = 0;
+    t = (x ^ (x >> 1)) & 0x22222222u;
+    x ^= t ^ (t << 1);
+    t = (x ^ (x >> 2)) & 0x0c0c0c0cu;
+    x ^= t ^ (t << 2);
+    t = (x ^ (x >> 4)) & 0x00f000f0u;
+    x ^= t ^ (t << 4);
+    t = (x ^ (x >> 8)) & 0x0000ff00u;
+    x ^= t ^ (t << 8);
+    return x;
+  };
+
+  const uint32_t lo = unzip(static_cast<uint32_t>(word));
+  const uint32_t hi = unzip(static_cast<uint32_t>(word >> 32));
+
+  const uint32_t even = (lo & 0x0000ffffu) | (hi << 16);
+  const uint32_t odd = (lo >> 16) | (hi & 0xffff0000u);
+
+  return (static_cast<uint64_t>(odd) << 32) | even;
+}
+
+// Inverse of `bit_interleave`.
+forceinline constexpr uint64_t
+bit_deinterleave(const uint64_t word)
+{
+  auto zip = [](uint32_t x) {
+    uint32_t t = 0;
+    t = (x ^ (x >> 8)) & 0x0000ff00u;
+    x ^= t ^ (t << 8);
+    t = (x ^ (x >> 4)) & 0x00f000f0u;
+    x ^= t ^ (t << 4);
+    t = (x ^ (x >> 2)) & 0x0c0c0c0cu;
+    x ^= t ^ (t << 2);
+    t = (x ^ (x >> 1)) & 0x22222222u;
+    x ^= t ^ (t << 1);
+    return x;
+  };
+
+  const uint32_t even = static_cast<uint32_t>(word);
+  const uint32_t odd = static_cast<uint32_t>(word >> 32);
+
+  const uint32_t lo = zip((even & 0x0000ffffu) | (odd << 16));
+  const uint32_t hi = zip((even >> 16) | (odd & 0xffff0000u));
+
+  return (static_cast<uint64_t>(hi) << 32) | lo;
+}
+
+// 320 -bit Ascon permutation state, same as `ascon_perm_u64_t`, but each 64 -bit word is kept bit-interleaved i.e. as two 32 -bit halves, holding its even and
+// odd bits. A 64 -bit rotation then becomes a pair of 32 -bit rotations, which is much cheaper on 32 -bit targets, where 64 -bit rotation needs a handful of
+// instructions. Conversion only happens when a word is read or written through accessors, never while permuting.
+struct ascon_perm_bi32_t
+{
+private:
+  // 320 -bit Ascon permutation state, as ten 32 -bit halves | state[2*i] holds even bits and state[2*i + 1] holds odd bits of word i.
+  std::array<uint32_t, 2 * PERMUTATION_STATE_WORD_COUNT> state{};
+  static_assert(sizeof(state) * std::numeric_limits<uint8_t>::digits == PERMUTATION_STATE_BITWIDTH);
+
+  // Round constants, bit-interleaved ahead of time | [2*i] is even half and [2*i + 1] is odd half of i-th round constant.
+  static constexpr std::array<uint32_t, 2 * ASCON_PERMUTATION_MAX_ROUNDS> ROUND_CONSTANTS = []() {
+    std::array<uint32_t, 2 * ASCON_PERMUTATION_MAX_ROUNDS> rcs{};
+    for (size_t i = 0; i < ASCON_PERMUTATION_MAX_ROUNDS; i++) {
+      const uint64_t rc = bit_interleave(ASCON_PERMUTATION_ROUND_CONSTANTS[i]);
+
+      rcs[2 * i + 0] = static_cast<uint32_t>(rc);
+      rcs[2 * i + 1] = static_cast<uint32_t>(rc >> 32);
+    }
+    return rcs;
+  }();
+
+  // Substitution layer, applied on one half (either even or odd) of all five words; see `ascon_perm_u64_t::p_s`.
+  forceinline static constexpr void p_s(uint32_t& x0, uint32_t& x1, uint32_t& x2, uint32_t& x3, uint32_t& x4)
+  {
+    x0 ^= x4;
+    x4 ^= x3;
+    x2 ^= x1;
+
+    const uint32_t row0 = x0 ^ (~x1 & x2);
+    const uint32_t row2 = x2 ^ (~x3 & x4);
+    const uint32_t row4 = x4 ^ (~x0 & x1);
+    const uint32_t row1 = x1 ^ (~x2 & x3);
+    const uint32_t row3 = x3 ^ (~x4 & x0);
+
+    x1 = row1 ^ row0;
+    x3 = row3 ^ row2;
+    x0 = row0 ^ row4;
+    x4 = row4;
+    x2 = ~row2;
+  }
+
+  // Rotates a bit-interleaved 64 -bit word right by n -bits. Even rotation amount rotates both halves by n/2, while odd one also swaps the halves.
+  template<const size_t n>
+  forceinline static constexpr void rotr(const uint32_t even, const uint32_t odd, uint32_t& rot_even, uint32_t& rot_odd)
+  {
+    if constexpr (n % 2 == 0) {
+      rot_even = std::rotr(even, n / 2);
+      rot_odd = std::rotr(odd, n / 2);
+    } else {
+      rot_even = std::rotr(odd, (n - 1) / 2);
+      rot_odd = std::rotr(even, (n + 1) / 2);
+    }
+  }
+
+  // Linear diffusion of one bit-interleaved word i.e. x ^= (x >>> r0) ^ (x >>> r1); see `ascon_perm_u64_t::p_l`.
+  template<const size_t r0, const size_t r1>
+  forceinline static constexpr void p_l(uint32_t& even, uint32_t& odd)
+  {
+    uint32_t even0 = 0, odd0 = 0, even1 = 0, odd1 = 0;
+
+    rotr<r0>(even, odd, even0, odd0);
+    rotr<r1>(even, odd, even1, odd1);
+
+    even ^= even0 ^ even1;
+    odd ^= odd0 ^ odd1;
+  }
+
+  // Single round of Ascon permutation, on bit-interleaved state.
+  forceinline constexpr void round(const size_t rc_idx)
+  {
+    state[4] ^= ROUND_CONSTANTS[2 * rc_idx + 0];
+    state[5] ^= ROUND_CONSTANTS[2 * rc_idx + 1];
+
+    p_s(state[0], state[2], state[4], state[6], state[8]);
+    p_s(state[1], state[3], state[5], state[7], state[9]);
+
+    p_l<19, 28>(state[0], state[1]);
+    p_l<61, 39>(state[2], state[3]);
+    p_l<1, 6>(state[4], state[5]);
+    p_l<10, 17>(state[6], state[7]);
+    p_l<7, 41>(state[8], state[9]);
+  }
+
+public:
+  // Constructor(s)/ Destructor(s)
+  forceinline constexpr ascon_perm_bi32_t() = default;
+  forceinline constexpr ~ascon_perm_bi32_t() { reset(); }
+
+  forceinline constexpr ascon_perm_bi32_t(const std::array<uint64_t, 5>& words)
+  {
+    for (size_t i = 0; i < words.size(); i++) {
+      set_word(i, words[i]);
+    }
+  }
+
+  // Accessor(s), converting to/ from bit-interleaved representation.
+  [[nodiscard]]
+  forceinline constexpr uint64_t operator[](const size_t idx) const
+  {
+    return from_native(native_word(idx));
+  }
+  forceinline constexpr void set_word(const size_t idx, const uint64_t word) { set_native_word(idx, to_native(word)); }
+  forceinline constexpr void xor_word(const size_t idx, const uint64_t word) { xor_native_word(idx, to_native(word)); }
+
+  // State representation trait; see `ascon_perm_state`. Native form of a word is its bit-interleaved form i.e. even bits in low and odd bits in high half.
+  [[nodiscard]]
+  forceinline static constexpr uint64_t to_native(const uint64_t word)
+  {
+    return bit_interleave(word);
+  }
+  [[nodiscard]]
+  forceinline static constexpr uint64_t from_native(const uint64_t word)
+  {
+    return bit_deinterleave(word);
+  }
+  [[nodiscard]]
+  forceinline constexpr uint64_t native_word(const size_t idx) const
+  {
+    return (static_cast<uint64_t>(state[2 * idx + 1]) << 32) | state[2 * idx];
+  }
+  forceinline constexpr void set_native_word(const size_t idx, const uint64_t word)
+  {
+    state[2 * idx + 0] = static_cast<uint32_t>(word);
+    state[2 * idx + 1] = static_cast<uint32_t>(word >> 32);
+  }
+  forceinline constexpr void xor_native_word(const size_t idx, const uint64_t word)
+  {
+    state[2 * idx + 0] ^= static_cast<uint32_t>(word);
+    state[2 * idx + 1] ^= static_cast<uint32_t>(word >> 32);
+  }
+
+  [[nodiscard]]
+  forceinline constexpr std::array<uint64_t, 5> reveal() const
+  {
+    std::array<uint64_t, 5> words{};
+    for (size_t i = 0; i < words.size(); i++) {
+      words[i] = (*this)[i];
+    }
+
+    return words;
+  }
+  forceinline constexpr void reset() { state.fill(0); }
+
+  // Applies Ascon permutation round for R -many times | R <= 16, on bit-interleaved state.
+  template<const size_t R>
+  forceinline constexpr void permute()
+    requires(R <= ASCON_PERMUTATION_MAX_ROUNDS)
+  {
+    ascon_instrumentation::record_permutation<R>();
+
+    for (size_t i = ASCON_PERMUTATION_MAX_ROUNDS - R; i < ASCON_PERMUTATION_MAX_ROUNDS; i++) {
+      round(i);
+    }
+  }
+};
+
+// State representation trait, satisfied by all Ascon permutation state types. Besides applying permutation, a state type exposes its words both in standard
+// form i.e. `operator[]`, `set_word`, `xor_word`, and in the form it natively keeps them i.e. `native_word`, `set_native_word`, `xor_native_word`, along
+// with `to_native`/ `from_native` for converting between the two. Modes are written against it, so that the state stays in native form for a whole
+// message, only words flowing in or out are converted, and a word mixed into the state repeatedly (e.g. key) can be converted once.
+template<typename perm_t>
+concept ascon_perm_state = requires(perm_t& state, const perm_t& const_state, const size_t idx, const uint64_t word) {
+  { const_state[idx] } -> std::convertible_to<uint64_t>;
+  { const_state.native_word(idx) } -> std::same_as<uint64_t>;
+  { perm_t::to_native(word) } -> std::same_as<uint64_t>;
+  { perm_t::from_native(word) } -> std::same_as<uint64_t>;
+  state.set_word(idx, word);
+  state.xor_word(idx, word);
+  state.set_native_word(idx, word);
+  state.xor_native_word(idx, word);
+  state.template permute<ASCON_PERMUTATION_MAX_ROUNDS>();
+};
+
+static_assert(ascon_perm_state<ascon_perm_u64_t>);
+static_assert(ascon_perm_state<ascon_perm_bi32_t>);
+
+// Permutation state used by all modes. Define `ASCON_PERM_BIT_INTERLEAVED` to use the bit-interleaved representation, which is faster on 32 -bit targets.
+#if defined(ASCON_PERM_BIT_INTERLEAVED)
+using ascon_perm_t = ascon_perm_bi32_t;
+#else
+using ascon_perm_t = ascon_perm_u64_t;
+#endif
+
 }
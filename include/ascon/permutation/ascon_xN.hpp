@@ -0,0 +1,189 @@
+#pragma once
+#include "ascon/permutation/ascon.hpp"
+#include "ascon/permutation/backends/portable.hpp"
+#include "ascon/permutation/dispatch.hpp"
+#include "ascon/utils/common.hpp"
+#include "ascon/utils/force_inline.hpp"
+#include "ascon/utils/instrumentation.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#if defined(ASCON_PERM_RUNTIME_DISPATCH) || defined(__AVX2__)
+#define ASCON_PERM_HAS_AVX2_BACKEND 1
+#include "ascon/permutation/backends/avx2.hpp"
+#endif
+#if defined(ASCON_PERM_RUNTIME_DISPATCH) || defined(__AVX512F__)
+#define ASCON_PERM_HAS_AVX512_BACKEND 1
+#include "ascon/permutation/backends/avx512.hpp"
+#endif
+#if defined(__ARM_NEON)
+#define ASCON_PERM_HAS_NEON_BACKEND 1
+#include "ascon/permutation/backends/neon.hpp"
+#endif
+#if defined(__ARM_FEATURE_SVE)
+#define ASCON_PERM_HAS_SVE_BACKEND 1
+#include "ascon/permutation/backends/sve.hpp"
+#endif
+
+// Multi-lane Ascon Permutation.
+namespace ascon_perm {
+
+// Number of independent permutation states, the widest SIMD backend compiled in can process at once. When backend is selected at run-time, it's a
+// multiple of lane count of each of them, so that no backend has to fall back to the portable one.
+#if defined(ASCON_PERM_HAS_AVX512_BACKEND)
+static constexpr size_t NATIVE_LANE_COUNT = ascon_perm_avx512::LANE_COUNT;
+#elif defined(ASCON_PERM_HAS_AVX2_BACKEND)
+static constexpr size_t NATIVE_LANE_COUNT = ascon_perm_avx2::LANE_COUNT;
+#elif defined(ASCON_PERM_HAS_SVE_BACKEND)
+static constexpr size_t NATIVE_LANE_COUNT = ascon_perm_sve::PREFERRED_LANE_COUNT;
+#elif defined(ASCON_PERM_HAS_NEON_BACKEND)
+static constexpr size_t NATIVE_LANE_COUNT = ascon_perm_neon::LANE_COUNT;
+#else
+static constexpr size_t NATIVE_LANE_COUNT = 2;
+#endif
+
+// N -many independent 320 -bit Ascon permutation states, on which we can apply n (<=16) -rounds permutation instance, all at once. States are kept in
+// structure-of-arrays layout, so that each of five permutation state words of N states can be processed using SIMD instructions.
+template<const size_t N>
+  requires(N > 0)
+struct ascon_perm_xN_t
+{
+private:
+  // N -many 320 -bit Ascon permutation states.
+  alignas(64) ascon_perm_portable::multi_lane_state_t<N> state{};
+
+public:
+  static constexpr size_t LANE_COUNT = N;
+
+  // Constructor(s)/ Destructor(s)
+  forceinline constexpr ascon_perm_xN_t() = default;
+  forceinline constexpr ~ascon_perm_xN_t() { reset(); }
+
+  // Accessor(s)
+  [[nodiscard]]
+  forceinline constexpr uint64_t& operator()(const size_t word_idx, const size_t lane_idx)
+  {
+    return state[word_idx][lane_idx];
+  }
+  [[nodiscard]]
+  forceinline constexpr const uint64_t& operator()(const size_t word_idx, const size_t lane_idx) const
+  {
+    return state[word_idx][lane_idx];
+  }
+
+  // Overwrites permutation state of lane `lane_idx` with given scalar permutation state.
+  forceinline constexpr void set_lane(const size_t lane_idx, const ascon_perm_t& lane_state)
+  {
+    for (size_t word_idx = 0; word_idx < PERMUTATION_STATE_WORD_COUNT; word_idx++) {
+      state[word_idx][lane_idx] = lane_state[word_idx];
+    }
+  }
+
+  // Returns permutation state of lane `lane_idx`, as a scalar permutation state.
+  [[nodiscard]]
+  forceinline constexpr ascon_perm_t get_lane(const size_t lane_idx) const
+  {
+    std::array<uint64_t, PERMUTATION_STATE_WORD_COUNT> words{};
+    for (size_t word_idx = 0; word_idx < PERMUTATION_STATE_WORD_COUNT; word_idx++) {
+      words[word_idx] = state[word_idx][lane_idx];
+    }
+
+    return ascon_perm_t(words);
+  }
+
+  forceinline constexpr void reset()
+  {
+    for (auto& row : state) {
+      row.fill(0);
+    }
+  }
+
+  // Applies Ascon permutation round for R -many times | R <= 16, on each of N states. Uses the backend selected at run-time (see `active_backend`), as long
+  // as N is a multiple of its lane count, otherwise falls back to the next narrower one. SVE backend, being vector-length agnostic, takes any N. Each lane is
+  // counted as a permutation call, by instrumentation.
+  template<const size_t R>
+  forceinline constexpr void permute()
+    requires(R <= ASCON_PERMUTATION_MAX_ROUNDS)
+  {
+    permute<R>(N);
+  }
+
+  // Same as above, for when only `num_active_lanes` of N lanes carry a state, which is being worked on, while permutation output of the rest (e.g. lanes left
+  // without a message) is ignored by the caller. All lanes are permuted, but only active ones are counted as permutation calls, by instrumentation.
+  template<const size_t R>
+  forceinline constexpr void permute(const size_t num_active_lanes)
+    requires(R <= ASCON_PERMUTATION_MAX_ROUNDS)
+  {
+    ascon_instrumentation::record_permutation<R>(num_active_lanes);
+
+    if (std::is_constant_evaluated()) {
+      ascon_perm_portable::permute<R, N>(state);
+      return;
+    }
+
+    switch (active_backend()) {
+#if defined(ASCON_PERM_HAS_AVX512_BACKEND)
+      case ascon_perm_backend_t::avx512:
+        if constexpr (N % ascon_perm_avx512::LANE_COUNT == 0) {
+          ascon_perm_avx512::permute<R, N>(state);
+          return;
+        }
+        [[fallthrough]];
+#endif
+#if defined(ASCON_PERM_HAS_AVX2_BACKEND)
+      case ascon_perm_backend_t::avx2:
+        if constexpr (N % ascon_perm_avx2::LANE_COUNT == 0) {
+          ascon_perm_avx2::permute<R, N>(state);
+          return;
+        }
+        [[fallthrough]];
+#endif
+#if defined(ASCON_PERM_HAS_SVE_BACKEND)
+      case ascon_perm_backend_t::sve:
+        ascon_perm_sve::permute<R, N>(state);
+        return;
+#endif
+#if defined(ASCON_PERM_HAS_NEON_BACKEND)
+      case ascon_perm_backend_t::neon:
+        if constexpr (N % ascon_perm_neon::LANE_COUNT == 0) {
+          ascon_perm_neon::permute<R, N>(state);
+          return;
+        }
+        [[fallthrough]];
+#endif
+      default:
+        ascon_perm_portable::permute<R, N>(state);
+    }
+  }
+
+  // Same as above, but permutation state of only those lanes, for which `is_active[lane_idx]` is set, are updated. Rest are left untouched, and not counted
+  // as permutation calls, by instrumentation.
+  template<const size_t R>
+  forceinline constexpr void permute(const std::array<bool, N>& is_active)
+    requires(R <= ASCON_PERMUTATION_MAX_ROUNDS)
+  {
+    size_t num_active_lanes = 0;
+    for (const bool is_lane_active : is_active) {
+      num_active_lanes += is_lane_active;
+    }
+
+    auto saved_state = state;
+    permute<R>(num_active_lanes);
+
+    for (size_t lane_idx = 0; lane_idx < N; lane_idx++) {
+      if (!is_active[lane_idx]) {
+        for (size_t word_idx = 0; word_idx < PERMUTATION_STATE_WORD_COUNT; word_idx++) {
+          state[word_idx][lane_idx] = saved_state[word_idx][lane_idx];
+        }
+      }
+    }
+
+    // Saved state can be keyed e.g. in Ascon-AEAD128, so it's not left behind on the stack.
+    ascon_common_utils::secure_wipe(std::span(saved_state));
+  }
+};
+
+}
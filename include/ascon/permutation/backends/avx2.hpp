@@ -0,0 +1,85 @@
+#pragma once
+#include "ascon/permutation/backends/portable.hpp"
+#include "ascon/utils/force_inline.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+// Lets this backend be compiled in, irrespective of the ISA, rest of the translation unit is targeting, so that it can be selected at run-time.
+#if defined(__GNUC__)
+#define ASCON_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define ASCON_AVX2_TARGET
+#endif
+
+// AVX2 multi-lane Ascon permutation backend, processing 4 states at a time, using 256 -bit registers.
+namespace ascon_perm_avx2 {
+
+static constexpr size_t LANE_COUNT = 4;
+
+// Rotates each 64 -bit word right by n -bits.
+template<const int n>
+forceinline ASCON_AVX2_TARGET __m256i
+rotr(const __m256i x)
+{
+  return _mm256_or_si256(_mm256_srli_epi64(x, n), _mm256_slli_epi64(x, 64 - n));
+}
+
+// Single round of Ascon permutation, applied on 4 states; see `ascon_perm::ascon_perm_t::round` for the scalar version of same.
+forceinline ASCON_AVX2_TARGET void
+round(__m256i& x0, __m256i& x1, __m256i& x2, __m256i& x3, __m256i& x4, const uint64_t rc)
+{
+  x2 = _mm256_xor_si256(x2, _mm256_set1_epi64x(static_cast<int64_t>(rc)));
+
+  x0 = _mm256_xor_si256(x0, x4);
+  x4 = _mm256_xor_si256(x4, x3);
+  x2 = _mm256_xor_si256(x2, x1);
+
+  const __m256i row0 = _mm256_xor_si256(x0, _mm256_andnot_si256(x1, x2));
+  const __m256i row2 = _mm256_xor_si256(x2, _mm256_andnot_si256(x3, x4));
+  const __m256i row4 = _mm256_xor_si256(x4, _mm256_andnot_si256(x0, x1));
+  const __m256i row1 = _mm256_xor_si256(x1, _mm256_andnot_si256(x2, x3));
+  const __m256i row3 = _mm256_xor_si256(x3, _mm256_andnot_si256(x4, x0));
+
+  x1 = _mm256_xor_si256(row1, row0);
+  x3 = _mm256_xor_si256(row3, row2);
+  x0 = _mm256_xor_si256(row0, row4);
+  x4 = row4;
+  x2 = _mm256_xor_si256(row2, _mm256_set1_epi64x(-1));
+
+  x0 = _mm256_xor_si256(x0, _mm256_xor_si256(rotr<19>(x0), rotr<28>(x0)));
+  x1 = _mm256_xor_si256(x1, _mm256_xor_si256(rotr<61>(x1), rotr<39>(x1)));
+  x2 = _mm256_xor_si256(x2, _mm256_xor_si256(rotr<1>(x2), rotr<6>(x2)));
+  x3 = _mm256_xor_si256(x3, _mm256_xor_si256(rotr<10>(x3), rotr<17>(x3)));
+  x4 = _mm256_xor_si256(x4, _mm256_xor_si256(rotr<7>(x4), rotr<41>(x4)));
+}
+
+// Applies R -rounds Ascon permutation on each of N states, 4 states at a time | N is a multiple of 4.
+// Deliberately not force-inlined, because it can't be inlined into callers, which are not themselves compiled for AVX2.
+template<const size_t R, const size_t N>
+inline ASCON_AVX2_TARGET void
+permute(ascon_perm_portable::multi_lane_state_t<N>& state)
+  requires((R <= ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS) && (N % LANE_COUNT == 0))
+{
+  constexpr size_t BEG = ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS - R;
+
+  for (size_t lane = 0; lane < N; lane += LANE_COUNT) {
+    __m256i x0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[0].data() + lane));
+    __m256i x1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[1].data() + lane));
+    __m256i x2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[2].data() + lane));
+    __m256i x3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[3].data() + lane));
+    __m256i x4 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[4].data() + lane));
+
+    for (size_t i = BEG; i < ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS; i++) {
+      round(x0, x1, x2, x3, x4, ascon_perm::ASCON_PERMUTATION_ROUND_CONSTANTS[i]);
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[0].data() + lane), x0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[1].data() + lane), x1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[2].data() + lane), x2);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[3].data() + lane), x3);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[4].data() + lane), x4);
+  }
+}
+
+}
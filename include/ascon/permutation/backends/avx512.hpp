@@ -0,0 +1,79 @@
+#pragma once
+#include "ascon/permutation/backends/avx512_single.hpp"
+#include "ascon/permutation/backends/portable.hpp"
+#include "ascon/utils/force_inline.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+// AVX-512 multi-lane Ascon permutation backend, processing 8 states at a time, using 512 -bit registers. Boolean functions of three inputs are computed
+// using a single `vpternlogq` instruction, whose immediate operands are shared with the single-state backend.
+namespace ascon_perm_avx512 {
+
+static constexpr size_t LANE_COUNT = 8;
+
+// Rotates each 64 -bit word right by n -bits. Zero-masking form of `vprorq` is used, only because unmasked intrinsic trips GCC's `-Wmaybe-uninitialized`.
+template<const int n>
+forceinline ASCON_AVX512_TARGET __m512i
+rotr(const __m512i x)
+{
+  return _mm512_maskz_ror_epi64(0xff, x, n);
+}
+
+// Single round of Ascon permutation, applied on 8 states; see `ascon_perm::ascon_perm_t::round` for the scalar version of same.
+forceinline ASCON_AVX512_TARGET void
+round(__m512i& x0, __m512i& x1, __m512i& x2, __m512i& x3, __m512i& x4, const uint64_t rc)
+{
+  x2 = _mm512_xor_si512(x2, _mm512_set1_epi64(static_cast<int64_t>(rc)));
+
+  x0 = _mm512_xor_si512(x0, x4);
+  x4 = _mm512_xor_si512(x4, x3);
+  x2 = _mm512_xor_si512(x2, x1);
+
+  const __m512i row0 = _mm512_ternarylogic_epi64(x0, x1, x2, XOR_ANDNOT);
+  const __m512i row2 = _mm512_ternarylogic_epi64(x2, x3, x4, XOR_ANDNOT);
+  const __m512i row4 = _mm512_ternarylogic_epi64(x4, x0, x1, XOR_ANDNOT);
+  const __m512i row1 = _mm512_ternarylogic_epi64(x1, x2, x3, XOR_ANDNOT);
+  const __m512i row3 = _mm512_ternarylogic_epi64(x3, x4, x0, XOR_ANDNOT);
+
+  x1 = _mm512_xor_si512(row1, row0);
+  x3 = _mm512_xor_si512(row3, row2);
+  x0 = _mm512_xor_si512(row0, row4);
+  x4 = row4;
+
+  x0 = _mm512_ternarylogic_epi64(x0, rotr<19>(x0), rotr<28>(x0), XOR3);
+  x1 = _mm512_ternarylogic_epi64(x1, rotr<61>(x1), rotr<39>(x1), XOR3);
+  x2 = _mm512_ternarylogic_epi64(row2, rotr<1>(row2), rotr<6>(row2), XNOR3);
+  x3 = _mm512_ternarylogic_epi64(x3, rotr<10>(x3), rotr<17>(x3), XOR3);
+  x4 = _mm512_ternarylogic_epi64(x4, rotr<7>(x4), rotr<41>(x4), XOR3);
+}
+
+// Applies R -rounds Ascon permutation on each of N states, 8 states at a time | N is a multiple of 8.
+// Deliberately not force-inlined, because it can't be inlined into callers, which are not themselves compiled for AVX-512.
+template<const size_t R, const size_t N>
+inline ASCON_AVX512_TARGET void
+permute(ascon_perm_portable::multi_lane_state_t<N>& state)
+  requires((R <= ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS) && (N % LANE_COUNT == 0))
+{
+  constexpr size_t BEG = ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS - R;
+
+  for (size_t lane = 0; lane < N; lane += LANE_COUNT) {
+    __m512i x0 = _mm512_loadu_si512(state[0].data() + lane);
+    __m512i x1 = _mm512_loadu_si512(state[1].data() + lane);
+    __m512i x2 = _mm512_loadu_si512(state[2].data() + lane);
+    __m512i x3 = _mm512_loadu_si512(state[3].data() + lane);
+    __m512i x4 = _mm512_loadu_si512(state[4].data() + lane);
+
+    for (size_t i = BEG; i < ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS; i++) {
+      round(x0, x1, x2, x3, x4, ascon_perm::ASCON_PERMUTATION_ROUND_CONSTANTS[i]);
+    }
+
+    _mm512_storeu_si512(state[0].data() + lane, x0);
+    _mm512_storeu_si512(state[1].data() + lane, x1);
+    _mm512_storeu_si512(state[2].data() + lane, x2);
+    _mm512_storeu_si512(state[3].data() + lane, x3);
+    _mm512_storeu_si512(state[4].data() + lane, x4);
+  }
+}
+
+}
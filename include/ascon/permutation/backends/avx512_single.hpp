@@ -0,0 +1,91 @@
+#pragma once
+#include "ascon/utils/force_inline.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+// Lets this backend be compiled in, irrespective of the ISA, rest of the translation unit is targeting, so that it can be selected at run-time.
+#if defined(__GNUC__)
+#define ASCON_AVX512_TARGET __attribute__((target("avx512f")))
+#else
+#define ASCON_AVX512_TARGET
+#endif
+
+// AVX-512 single-state Ascon permutation, keeping all five words of one 320 -bit state in a single 512 -bit register, one word per 64 -bit lane (upper three
+// lanes are unused). Words are lined up against their neighbours using `vpermq`, so that the S-box layer is computed by a single `vpternlogq`, while all
+// rotations of the linear diffusion layer are done by two `vprorvq`, with per-lane rotation counts. It trades instruction count for cross-lane shuffles,
+// which add latency, so it's only used by `ascon_perm_u64_t`, when `ASCON_PERM_SINGLE_STATE_AVX512` is defined. Also hosts helpers, shared with the
+// multi-lane AVX-512 backend.
+namespace ascon_perm_avx512 {
+
+// Compile-time compute 8 -bit immediate operand of `vpternlogq`, encoding truth table of boolean function `f(a, b, c)`.
+template<typename F>
+consteval int
+ternlog_imm(F f)
+{
+  int imm = 0;
+  for (int i = 0; i < 8; i++) {
+    const bool a = (i >> 2) & 1;
+    const bool b = (i >> 1) & 1;
+    const bool c = (i >> 0) & 1;
+
+    imm |= static_cast<int>(f(a, b, c)) << i;
+  }
+
+  return imm;
+}
+
+// a ^ (~b & c) i.e. one row of the chi-like S-box layer.
+static constexpr int XOR_ANDNOT = ternlog_imm([](bool a, bool b, bool c) { return a ^ (!b & c); });
+// a ^ b ^ c i.e. one row of the linear diffusion layer.
+static constexpr int XOR3 = ternlog_imm([](bool a, bool b, bool c) { return a ^ b ^ c; });
+// ~(a ^ b ^ c) i.e. one row of the linear diffusion layer, fused with the preceding negation of S-box row 2.
+static constexpr int XNOR3 = ternlog_imm([](bool a, bool b, bool c) { return !(a ^ b ^ c); });
+
+// Lanes of the register holding the five state words. Shuffles and rotations are zero-masking, with these lanes set, which also keeps GCC's
+// `-Wmaybe-uninitialized` from tripping over unmasked intrinsics.
+static constexpr __mmask8 STATE_LANES = 0b00011111;
+
+// Single round of Ascon permutation, applied on a state held in one register; see `ascon_perm::ascon_perm_u64_t::round` for the scalar version of same.
+forceinline ASCON_AVX512_TARGET __m512i
+round_single(const __m512i x, const uint64_t rc)
+{
+  // x0 ^= x4, x4 ^= x3 and x2 ^= x1, along with addition of round constant to x2
+  const __m512i pre_mix = _mm512_maskz_permutexvar_epi64(0b00010101, _mm512_set_epi64(0, 0, 0, 3, 0, 1, 0, 4), x);
+  const __m512i added_rc = _mm512_maskz_set1_epi64(0b00000100, static_cast<int64_t>(rc));
+  const __m512i mixed = _mm512_ternarylogic_epi64(x, pre_mix, added_rc, XOR3);
+
+  // Row i = x_i ^ (~x_{i+1} & x_{i+2}), for all five rows at once
+  const __m512i next1 = _mm512_maskz_permutexvar_epi64(STATE_LANES, _mm512_set_epi64(0, 0, 0, 0, 4, 3, 2, 1), mixed);
+  const __m512i next2 = _mm512_maskz_permutexvar_epi64(STATE_LANES, _mm512_set_epi64(0, 0, 0, 1, 0, 4, 3, 2), mixed);
+  const __m512i rows = _mm512_ternarylogic_epi64(mixed, next1, next2, XOR_ANDNOT);
+
+  // x1 = row1 ^ row0, x3 = row3 ^ row2, x0 = row0 ^ row4 and x2 = ~row2
+  const __m512i post_mix = _mm512_maskz_permutexvar_epi64(0b00001011, _mm512_set_epi64(0, 0, 0, 0, 2, 0, 0, 4), rows);
+  const __m512i negate_row2 = _mm512_maskz_set1_epi64(0b00000100, -1);
+  const __m512i sboxed = _mm512_ternarylogic_epi64(rows, post_mix, negate_row2, XOR3);
+
+  // x_i ^= (x_i >>> a_i) ^ (x_i >>> b_i)
+  const __m512i rot_a = _mm512_maskz_rorv_epi64(STATE_LANES, sboxed, _mm512_set_epi64(0, 0, 0, 7, 10, 1, 61, 19));
+  const __m512i rot_b = _mm512_maskz_rorv_epi64(STATE_LANES, sboxed, _mm512_set_epi64(0, 0, 0, 41, 17, 6, 39, 28));
+  return _mm512_ternarylogic_epi64(sboxed, rot_a, rot_b, XOR3);
+}
+
+// Applies R -rounds Ascon permutation on a single state, given round constants of all rounds, out of which last R are used. Not force-inlined, so that it can
+// be called from code not compiled for AVX-512, after checking CPU support; when the whole program targets AVX-512, compiler inlines it anyway.
+template<const size_t R, const size_t MAX_ROUNDS>
+inline ASCON_AVX512_TARGET void
+permute_single(std::array<uint64_t, 5>& state, const std::array<uint8_t, MAX_ROUNDS>& round_constants)
+  requires(R <= MAX_ROUNDS)
+{
+  __m512i x = _mm512_maskz_loadu_epi64(STATE_LANES, state.data());
+
+  for (size_t i = MAX_ROUNDS - R; i < MAX_ROUNDS; i++) {
+    x = round_single(x, round_constants[i]);
+  }
+
+  _mm512_mask_storeu_epi64(state.data(), STATE_LANES, x);
+}
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include "ascon/permutation/backends/portable.hpp"
+#include "ascon/utils/force_inline.hpp"
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+
+// NEON multi-lane Ascon permutation backend, processing 2 states at a time, using 128 -bit registers. NEON is part of the baseline ISA of AArch64, so it
+// needs no run-time check. When targeting Armv8.2-A SHA3 extension (e.g. `-march=armv8.2-a+sha3` or `-mcpu=neoverse-v1`), three-way XOR and
+// bit-clear-and-XOR instructions `eor3` and `bcax` are used, saving one instruction per row of both S-box and linear diffusion layers.
+namespace ascon_perm_neon {
+
+static constexpr size_t LANE_COUNT = 2;
+
+// Rotates each 64 -bit word right by n -bits, using shift-right-and-insert on top of the left shifted word.
+template<const int n>
+forceinline uint64x2_t
+rotr(const uint64x2_t x)
+{
+  return vsriq_n_u64(vshlq_n_u64(x, 64 - n), x, n);
+}
+
+// a ^ (~b & c)
+forceinline uint64x2_t
+xor_andnot(const uint64x2_t a, const uint64x2_t b, const uint64x2_t c)
+{
+#if defined(__ARM_FEATURE_SHA3)
+  return vbcaxq_u64(a, c, b);
+#else
+  return veorq_u64(a, vbicq_u64(c, b));
+#endif
+}
+
+// a ^ b ^ c
+forceinline uint64x2_t
+xor3(const uint64x2_t a, const uint64x2_t b, const uint64x2_t c)
+{
+#if defined(__ARM_FEATURE_SHA3)
+  return veor3q_u64(a, b, c);
+#else
+  return veorq_u64(a, veorq_u64(b, c));
+#endif
+}
+
+// Single round of Ascon permutation, applied on 2 states; see `ascon_perm::ascon_perm_t::round` for the scalar version of same.
+forceinline void
+round(uint64x2_t& x0, uint64x2_t& x1, uint64x2_t& x2, uint64x2_t& x3, uint64x2_t& x4, const uint64_t rc)
+{
+  x0 = veorq_u64(x0, x4);
+  x4 = veorq_u64(x4, x3);
+  x2 = xor3(x2, x1, vdupq_n_u64(rc));
+
+  const uint64x2_t row0 = xor_andnot(x0, x1, x2);
+  const uint64x2_t row2 = xor_andnot(x2, x3, x4);
+  const uint64x2_t row4 = xor_andnot(x4, x0, x1);
+  const uint64x2_t row1 = xor_andnot(x1, x2, x3);
+  const uint64x2_t row3 = xor_andnot(x3, x4, x0);
+
+  x1 = veorq_u64(row1, row0);
+  x3 = veorq_u64(row3, row2);
+  x0 = veorq_u64(row0, row4);
+  x4 = row4;
+  x2 = veorq_u64(row2, vdupq_n_u64(UINT64_MAX));
+
+  x0 = xor3(x0, rotr<19>(x0), rotr<28>(x0));
+  x1 = xor3(x1, rotr<61>(x1), rotr<39>(x1));
+  x2 = xor3(x2, rotr<1>(x2), rotr<6>(x2));
+  x3 = xor3(x3, rotr<10>(x3), rotr<17>(x3));
+  x4 = xor3(x4, rotr<7>(x4), rotr<41>(x4));
+}
+
+// Applies R -rounds Ascon permutation on each of N states, 2 states at a time | N is a multiple of 2.
+template<const size_t R, const size_t N>
+forceinline void
+permute(ascon_perm_portable::multi_lane_state_t<N>& state)
+  requires((R <= ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS) && (N % LANE_COUNT == 0))
+{
+  constexpr size_t BEG = ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS - R;
+
+  for (size_t lane = 0; lane < N; lane += LANE_COUNT) {
+    uint64x2_t x0 = vld1q_u64(state[0].data() + lane);
+    uint64x2_t x1 = vld1q_u64(state[1].data() + lane);
+    uint64x2_t x2 = vld1q_u64(state[2].data() + lane);
+    uint64x2_t x3 = vld1q_u64(state[3].data() + lane);
+    uint64x2_t x4 = vld1q_u64(state[4].data() + lane);
+
+    for (size_t i = BEG; i < ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS; i++) {
+      round(x0, x1, x2, x3, x4, ascon_perm::ASCON_PERMUTATION_ROUND_CONSTANTS[i]);
+    }
+
+    vst1q_u64(state[0].data() + lane, x0);
+    vst1q_u64(state[1].data() + lane, x1);
+    vst1q_u64(state[2].data() + lane, x2);
+    vst1q_u64(state[3].data() + lane, x3);
+    vst1q_u64(state[4].data() + lane, x4);
+  }
+}
+
+}
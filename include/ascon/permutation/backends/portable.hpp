@@ -0,0 +1,65 @@
+#pragma once
+#include "ascon/permutation/ascon.hpp"
+#include "ascon/utils/force_inline.hpp"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// Portable multi-lane Ascon permutation backend, written such that the compiler can auto-vectorize the lane loop.
+namespace ascon_perm_portable {
+
+// N -many 320 -bit Ascon permutation states, kept in structure-of-arrays layout i.e. row `i` holds word `i` of all N states.
+template<const size_t N>
+using multi_lane_state_t = std::array<std::array<uint64_t, N>, ascon_perm::PERMUTATION_STATE_WORD_COUNT>;
+
+// Single round of Ascon permutation, applied on each of N states; see `ascon_perm::ascon_perm_t::round` for the scalar version of same.
+template<const size_t N>
+forceinline constexpr void
+round(multi_lane_state_t<N>& state, const uint64_t rc)
+{
+  for (size_t lane = 0; lane < N; lane++) {
+    uint64_t x0 = state[0][lane];
+    uint64_t x1 = state[1][lane];
+    uint64_t x2 = state[2][lane] ^ rc;
+    uint64_t x3 = state[3][lane];
+    uint64_t x4 = state[4][lane];
+
+    x0 ^= x4;
+    x4 ^= x3;
+    x2 ^= x1;
+
+    const uint64_t row0 = x0 ^ (~x1 & x2);
+    const uint64_t row2 = x2 ^ (~x3 & x4);
+    const uint64_t row4 = x4 ^ (~x0 & x1);
+    const uint64_t row1 = x1 ^ (~x2 & x3);
+    const uint64_t row3 = x3 ^ (~x4 & x0);
+
+    x1 = row1 ^ row0;
+    x3 = row3 ^ row2;
+    x0 = row0 ^ row4;
+    x4 = row4;
+    x2 = ~row2;
+
+    state[0][lane] = x0 ^ std::rotr(x0, 19) ^ std::rotr(x0, 28);
+    state[1][lane] = x1 ^ std::rotr(x1, 61) ^ std::rotr(x1, 39);
+    state[2][lane] = x2 ^ std::rotr(x2, 1) ^ std::rotr(x2, 6);
+    state[3][lane] = x3 ^ std::rotr(x3, 10) ^ std::rotr(x3, 17);
+    state[4][lane] = x4 ^ std::rotr(x4, 7) ^ std::rotr(x4, 41);
+  }
+}
+
+// Applies R -rounds Ascon permutation on each of N states.
+template<const size_t R, const size_t N>
+forceinline constexpr void
+permute(multi_lane_state_t<N>& state)
+  requires(R <= ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS)
+{
+  constexpr size_t BEG = ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS - R;
+
+  for (size_t i = BEG; i < ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS; i++) {
+    round<N>(state, ascon_perm::ASCON_PERMUTATION_ROUND_CONSTANTS[i]);
+  }
+}
+
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "ascon/permutation/backends/portable.hpp"
+#include "ascon/utils/force_inline.hpp"
+#include <arm_sve.h>
+#include <cstddef>
+#include <cstdint>
+
+// SVE multi-lane Ascon permutation backend, which is vector-length agnostic i.e. it processes as many states at a time, as there are 64 -bit elements in an
+// SVE register of the executing CPU (2 on 128 -bit implementations, 4 on 256 -bit ones, ...). Trailing states are handled using predicated loads and stores,
+// so that N doesn't need to be a multiple of the vector length, which is anyway not known until run-time. When targeting SVE2 (e.g. `-march=armv9-a`),
+// `eor3`, `bcax` and `sri` are used, saving one instruction per row of S-box layer and per rotation of linear diffusion layer.
+namespace ascon_perm_sve {
+
+// Lane count, multi-lane modes are instantiated with, by default, when this backend is compiled in. It's the vector length, when that's fixed during program
+// compilation (see `-msve-vector-bits`), otherwise it's 4 i.e. that of 256 -bit implementations, such as Neoverse V1. Other vector lengths work as well.
+#if defined(__ARM_FEATURE_SVE_BITS) && (__ARM_FEATURE_SVE_BITS > 0)
+static constexpr size_t PREFERRED_LANE_COUNT = __ARM_FEATURE_SVE_BITS / 64;
+#else
+static constexpr size_t PREFERRED_LANE_COUNT = 4;
+#endif
+
+// Number of states, processed at a time, by the executing CPU.
+[[nodiscard]]
+forceinline size_t
+lane_count()
+{
+  return svcntd();
+}
+
+// Rotates each 64 -bit word right by n -bits.
+template<const int n>
+forceinline svuint64_t
+rotr(const svbool_t pg, const svuint64_t x)
+{
+#if defined(__ARM_FEATURE_SVE2)
+  return svsri_n_u64(svlsl_n_u64_x(pg, x, 64 - n), x, n);
+#else
+  return svorr_u64_x(pg, svlsr_n_u64_x(pg, x, n), svlsl_n_u64_x(pg, x, 64 - n));
+#endif
+}
+
+// a ^ (~b & c)
+forceinline svuint64_t
+xor_andnot(const svbool_t pg, const svuint64_t a, const svuint64_t b, const svuint64_t c)
+{
+#if defined(__ARM_FEATURE_SVE2)
+  (void)pg;
+  return svbcax_u64(a, c, b);
+#else
+  return sveor_u64_x(pg, a, svbic_u64_x(pg, c, b));
+#endif
+}
+
+// a ^ b ^ c
+forceinline svuint64_t
+xor3(const svbool_t pg, const svuint64_t a, const svuint64_t b, const svuint64_t c)
+{
+#if defined(__ARM_FEATURE_SVE2)
+  (void)pg;
+  return sveor3_u64(a, b, c);
+#else
+  return sveor_u64_x(pg, a, sveor_u64_x(pg, b, c));
+#endif
+}
+
+// Single round of Ascon permutation, applied on as many states as the vector length; see `ascon_perm::ascon_perm_t::round` for the scalar version of same.
+forceinline void
+round(const svbool_t pg, svuint64_t& x0, svuint64_t& x1, svuint64_t& x2, svuint64_t& x3, svuint64_t& x4, const uint64_t rc)
+{
+  x0 = sveor_u64_x(pg, x0, x4);
+  x4 = sveor_u64_x(pg, x4, x3);
+  x2 = xor3(pg, x2, x1, svdup_n_u64(rc));
+
+  const svuint64_t row0 = xor_andnot(pg, x0, x1, x2);
+  const svuint64_t row2 = xor_andnot(pg, x2, x3, x4);
+  const svuint64_t row4 = xor_andnot(pg, x4, x0, x1);
+  const svuint64_t row1 = xor_andnot(pg, x1, x2, x3);
+  const svuint64_t row3 = xor_andnot(pg, x3, x4, x0);
+
+  x1 = sveor_u64_x(pg, row1, row0);
+  x3 = sveor_u64_x(pg, row3, row2);
+  x0 = sveor_u64_x(pg, row0, row4);
+  x4 = row4;
+  x2 = svnot_u64_x(pg, row2);
+
+  x0 = xor3(pg, x0, rotr<19>(pg, x0), rotr<28>(pg, x0));
+  x1 = xor3(pg, x1, rotr<61>(pg, x1), rotr<39>(pg, x1));
+  x2 = xor3(pg, x2, rotr<1>(pg, x2), rotr<6>(pg, x2));
+  x3 = xor3(pg, x3, rotr<10>(pg, x3), rotr<17>(pg, x3));
+  x4 = xor3(pg, x4, rotr<7>(pg, x4), rotr<41>(pg, x4));
+}
+
+// Applies R -rounds Ascon permutation on each of N states, as many states at a time as the vector length, for any N. Rounds are computed on all elements of
+// the registers, while only the ones holding states are loaded and stored back.
+template<const size_t R, const size_t N>
+forceinline void
+permute(ascon_perm_portable::multi_lane_state_t<N>& state)
+  requires(R <= ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS)
+{
+  constexpr size_t BEG = ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS - R;
+  const svbool_t all = svptrue_b64();
+
+  for (uint64_t lane = 0; lane < N; lane += lane_count()) {
+    const svbool_t active = svwhilelt_b64_u64(lane, static_cast<uint64_t>(N));
+
+    svuint64_t x0 = svld1_u64(active, state[0].data() + lane);
+    svuint64_t x1 = svld1_u64(active, state[1].data() + lane);
+    svuint64_t x2 = svld1_u64(active, state[2].data() + lane);
+    svuint64_t x3 = svld1_u64(active, state[3].data() + lane);
+    svuint64_t x4 = svld1_u64(active, state[4].data() + lane);
+
+    for (size_t i = BEG; i < ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS; i++) {
+      round(all, x0, x1, x2, x3, x4, ascon_perm::ASCON_PERMUTATION_ROUND_CONSTANTS[i]);
+    }
+
+    svst1_u64(active, state[0].data() + lane, x0);
+    svst1_u64(active, state[1].data() + lane, x1);
+    svst1_u64(active, state[2].data() + lane, x2);
+    svst1_u64(active, state[3].data() + lane, x3);
+    svst1_u64(active, state[4].data() + lane, x4);
+  }
+}
+
+}
@@ -0,0 +1,186 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+// On x86 targets, built with GCC or Clang, SIMD backends of the multi-lane Ascon permutation are always compiled in, using function-level target
+// attributes, and the one to use is picked at run-time, based on what the executing CPU supports. Elsewhere, the backend is picked at compile-time e.g. on
+// AArch64, NEON backend is always available, while SVE backend is compiled in, only when targeting SVE.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define ASCON_PERM_RUNTIME_DISPATCH 1
+#endif
+
+// Run-time selection of multi-lane Ascon permutation backend.
+namespace ascon_perm {
+
+// Name of the environment variable, which can be set to one of "portable", "avx2", "avx512", "neon" or "sve", forcing use of that backend, if supported by the
+// CPU.
+static constexpr const char* BACKEND_ENV_VAR = "ASCON_PERM_BACKEND";
+
+/**
+ * @brief Enumerates the backends, multi-lane Ascon permutation can be computed with.
+ */
+enum class ascon_perm_backend_t : uint8_t
+{
+  /// @brief Plain C++, written such that the compiler can auto-vectorize it, for whatever baseline ISA it's targeting e.g. SSE2 on x86_64.
+  portable = 0x01,
+
+  /// @brief Processes 4 states at a time, using 256 -bit AVX2 registers.
+  avx2,
+
+  /// @brief Processes 8 states at a time, using 512 -bit AVX-512F registers.
+  avx512,
+
+  /// @brief Processes 2 states at a time, using 128 -bit NEON registers, on Arm targets.
+  neon,
+
+  /// @brief Processes as many states at a time, as the SVE vector length of the executing CPU allows, on Arm targets compiled for SVE.
+  sve,
+};
+
+// Returns human readable name of the backend, same as what's accepted in `BACKEND_ENV_VAR`.
+[[nodiscard]]
+inline constexpr std::string_view
+backend_name(const ascon_perm_backend_t backend)
+{
+  switch (backend) {
+    case ascon_perm_backend_t::avx2:
+      return "avx2";
+    case ascon_perm_backend_t::avx512:
+      return "avx512";
+    case ascon_perm_backend_t::neon:
+      return "neon";
+    case ascon_perm_backend_t::sve:
+      return "sve";
+    default:
+      return "portable";
+  }
+}
+
+// Checks whether the executing CPU (and the OS) supports given backend.
+[[nodiscard]]
+inline bool
+is_backend_supported(const ascon_perm_backend_t backend)
+{
+  switch (backend) {
+#if defined(ASCON_PERM_RUNTIME_DISPATCH)
+    case ascon_perm_backend_t::avx2:
+      return __builtin_cpu_supports("avx2");
+    case ascon_perm_backend_t::avx512:
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2");
+#else
+    case ascon_perm_backend_t::avx2:
+#if defined(__AVX2__)
+      return true;
+#else
+      return false;
+#endif
+    case ascon_perm_backend_t::avx512:
+#if defined(__AVX512F__)
+      return true;
+#else
+      return false;
+#endif
+#endif
+    case ascon_perm_backend_t::neon:
+#if defined(__ARM_NEON)
+      return true;
+#else
+      return false;
+#endif
+    case ascon_perm_backend_t::sve:
+#if defined(__ARM_FEATURE_SVE)
+      return true;
+#else
+      return false;
+#endif
+    default:
+      return true;
+  }
+}
+
+// Returns the fastest backend, supported by the executing CPU.
+[[nodiscard]]
+inline ascon_perm_backend_t
+best_supported_backend()
+{
+  if (is_backend_supported(ascon_perm_backend_t::avx512)) {
+    return ascon_perm_backend_t::avx512;
+  }
+  if (is_backend_supported(ascon_perm_backend_t::avx2)) {
+    return ascon_perm_backend_t::avx2;
+  }
+  if (is_backend_supported(ascon_perm_backend_t::sve)) {
+    return ascon_perm_backend_t::sve;
+  }
+  if (is_backend_supported(ascon_perm_backend_t::neon)) {
+    return ascon_perm_backend_t::neon;
+  }
+  return ascon_perm_backend_t::portable;
+}
+
+// Picks the backend to start with, honouring `BACKEND_ENV_VAR`, when it names a supported backend. Otherwise the fastest supported one is picked, warning on
+// stderr, if `BACKEND_ENV_VAR` was set, so that a misspelled or unsupported override doesn't go unnoticed. It's called once per process, by `backend_slot`.
+[[nodiscard]]
+inline ascon_perm_backend_t
+initial_backend()
+{
+  const char* requested = std::getenv(BACKEND_ENV_VAR);
+  if (requested != nullptr) {
+    for (const auto backend : { ascon_perm_backend_t::portable,
+                                ascon_perm_backend_t::avx2,
+                                ascon_perm_backend_t::avx512,
+                                ascon_perm_backend_t::neon,
+                                ascon_perm_backend_t::sve }) {
+      if ((backend_name(backend) == requested) && is_backend_supported(backend)) {
+        return backend;
+      }
+    }
+
+    const auto fallback = best_supported_backend();
+    std::fprintf(stderr,
+                 "ascon: ignoring %s=%s, as it's not a known backend or not supported by this CPU, using %.*s instead\n",
+                 BACKEND_ENV_VAR,
+                 requested,
+                 static_cast<int>(backend_name(fallback).size()),
+                 backend_name(fallback).data());
+    return fallback;
+  }
+
+  return best_supported_backend();
+}
+
+// Process-wide slot, holding currently selected backend. It's initialized on first use.
+[[nodiscard]]
+inline std::atomic<ascon_perm_backend_t>&
+backend_slot()
+{
+  static std::atomic<ascon_perm_backend_t> slot{ initial_backend() };
+  return slot;
+}
+
+// Returns backend, currently used by multi-lane Ascon permutation.
+[[nodiscard]]
+inline ascon_perm_backend_t
+active_backend()
+{
+  return backend_slot().load(std::memory_order_relaxed);
+}
+
+// Switches multi-lane Ascon permutation to given backend, if it's supported by the executing CPU, returning truth value. Meant for testing and
+// benchmarking, it must not be called while some other thread is using multi-lane permutation.
+[[nodiscard]]
+inline bool
+set_active_backend(const ascon_perm_backend_t backend)
+{
+  if (!is_backend_supported(backend)) {
+    return false;
+  }
+
+  backend_slot().store(backend, std::memory_order_relaxed);
+  return true;
+}
+
+}
@@ -1,9 +1,12 @@
 #pragma once
 #include "ascon/utils/force_inline.hpp"
 #include "subtle.hpp"
+#include <algorithm>
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #include <span>
+#include <type_traits>
 
 namespace ascon_common_utils {
 
@@ -52,6 +55,47 @@ to_le_bytes(const uint64_t num, std::span<uint8_t, sizeof(num)> bytes)
   bytes[7] = static_cast<uint8_t>(num >> 56);
 }
 
+// Loads a 64-bit unsigned integer from a little-endian byte array, which doesn't need to be aligned. During program compilation time, it's same as
+// `from_le_bytes`, while at run-time, on little-endian targets, it compiles down to a single unaligned load.
+[[nodiscard]]
+forceinline constexpr uint64_t
+load_le_u64(std::span<const uint8_t, 8> bytes)
+{
+  if (!std::is_constant_evaluated() && (std::endian::native == std::endian::little)) {
+    uint64_t word = 0;
+    std::memcpy(&word, bytes.data(), sizeof(word));
+    return word;
+  }
+
+  return from_le_bytes(bytes);
+}
+
+// Stores a 64-bit unsigned integer to a little-endian byte array, which doesn't need to be aligned. During program compilation time, it's same as
+// `to_le_bytes`, while at run-time, on little-endian targets, it compiles down to a single unaligned store.
+forceinline constexpr void
+store_le_u64(const uint64_t num, std::span<uint8_t, sizeof(num)> bytes)
+{
+  if (!std::is_constant_evaluated() && (std::endian::native == std::endian::little)) {
+    std::memcpy(bytes.data(), &num, sizeof(num));
+    return;
+  }
+
+  to_le_bytes(num, bytes);
+}
+
+// Zeroes all elements of `arr`, such that the writes are not optimized away as dead stores, even when `arr` is about to go out of scope. Meant for wiping
+// secret material e.g. key words, before destruction.
+template<typename T, const size_t extent>
+forceinline constexpr void
+secure_wipe(std::span<T, extent> arr)
+{
+  std::fill(arr.begin(), arr.end(), T{});
+
+  if (!std::is_constant_evaluated()) {
+    __asm__ __volatile__("" : : "r"(arr.data()) : "memory");
+  }
+}
+
 // Performs a constant-time comparison of two byte arrays of length `len`. Returns all bits set (0xFFFFFFFF) if equal, otherwise all bits clear (0x00000000).
 template<const size_t len>
 [[nodiscard]]
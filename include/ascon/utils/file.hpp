@@ -0,0 +1,249 @@
+#pragma once
+#include "ascon/hashes/ascon_hash256.hpp"
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <fcntl.h>
+#include <span>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// Streaming (or memory mapping) files through Ascon, on POSIX systems.
+namespace ascon_file {
+
+// Size of the buffer, file is read into, piece by piece, when it can't be (or is asked not to be) memory mapped.
+static constexpr size_t READ_BUFFER_BYTE_LEN = 1'024 * 1'024;
+
+/**
+ * @brief Represents the status of an operation on a file.
+ */
+enum class ascon_file_status_t : uint8_t
+{
+  /// @brief Indicates that whole file was successfully processed.
+  processed_file = 0x01,
+
+  /// @brief Indicates that the file could not be opened for reading.
+  failed_to_open_file,
+
+  /// @brief Indicates that the file could not be stat-ed.
+  failed_to_stat_file,
+
+  /// @brief Indicates that memory mapping the file was requested, but it could not be mapped e.g. it's a pipe.
+  failed_to_map_file,
+
+  /// @brief Indicates that reading the file failed, midway.
+  failed_to_read_file,
+};
+
+/**
+ * @brief Enumerates the ways, content of a file can be accessed.
+ */
+enum class ascon_file_read_method_t : uint8_t
+{
+  /// @brief Memory map regular, non-empty files, falling back to buffered `read()` for the rest (or when mapping fails).
+  automatic = 0x01,
+
+  /// @brief Only memory map the file, failing if that's not possible.
+  mmap,
+
+  /// @brief Only read the file, piece by piece, using `read()` into a buffer of `READ_BUFFER_BYTE_LEN` -bytes.
+  buffered_read,
+};
+
+// Opens a file, retrying when interrupted by a signal, with close-on-exec flag set. Files, which get created, are given `mode` permission bits, subject to
+// umask. Returns the file descriptor, or -1 on failure, with `errno` set.
+[[nodiscard]]
+inline int
+open_file(const char* path, const int flags, const mode_t mode = 0644)
+{
+  int fd = -1;
+  do {
+    fd = ::open(path, flags | O_CLOEXEC, mode);
+  } while ((fd < 0) && (errno == EINTR));
+
+  return fd;
+}
+
+// Owns an open file descriptor and, optionally, a shared memory mapping of the file, releasing both when going out of scope.
+struct mapped_file_t
+{
+  int fd = -1;
+  uint8_t* base = nullptr;
+  size_t len = 0;
+
+  mapped_file_t() = default;
+  mapped_file_t(const mapped_file_t&) = delete;
+  mapped_file_t& operator=(const mapped_file_t&) = delete;
+
+  inline ~mapped_file_t()
+  {
+    unmap();
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+
+  [[nodiscard]]
+  inline bool open(const char* path, const int flags, const mode_t mode = 0644)
+  {
+    fd = open_file(path, flags, mode);
+    return fd >= 0;
+  }
+
+  // Maps first `byte_len` -bytes of the file. Nothing is mapped for an empty file, which is then seen as an empty span.
+  [[nodiscard]]
+  inline bool map(const size_t byte_len, const int prot)
+  {
+    if (byte_len == 0) {
+      return true;
+    }
+
+    void* mapped = ::mmap(nullptr, byte_len, prot, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+      return false;
+    }
+
+    base = static_cast<uint8_t*>(mapped);
+    len = byte_len;
+    return true;
+  }
+
+  inline void unmap()
+  {
+    if (base != nullptr) {
+      ::munmap(base, len);
+      base = nullptr;
+      len = 0;
+    }
+  }
+
+  [[nodiscard]]
+  inline std::span<uint8_t> bytes() const
+  {
+    return { base, len };
+  }
+};
+
+/**
+ * @brief Streams content of an open file descriptor, from its current offset till end, through `consume`, which is invoked with spans of bytes, in file
+ * order. When memory mapped, the whole remaining content is handed over at once, with `MADV_SEQUENTIAL` advice, without any copying; otherwise it's read into
+ * a buffer and handed over piece by piece. Either way, the same bytes are consumed and the descriptor is left positioned at the end of the file.
+ *
+ * @param fd Open, readable file descriptor. It's not closed.
+ * @param method How to access content of the file.
+ * @param consume Callable, invoked as `consume(std::span<const uint8_t>)`.
+ * @return An `ascon_file_status_t` indicating the status of the operation.
+ */
+template<typename F>
+[[nodiscard]]
+inline ascon_file_status_t
+stream_fd(const int fd, const ascon_file_read_method_t method, F&& consume)
+{
+  if (method != ascon_file_read_method_t::buffered_read) {
+    struct stat st{};
+    if (fstat(fd, &st) != 0) {
+      return ascon_file_status_t::failed_to_stat_file;
+    }
+
+    // Mapping starts at the page, holding current offset, as mmap(2) requires page aligned offsets, while bytes before the offset are skipped.
+    const off_t offset = S_ISREG(st.st_mode) ? ::lseek(fd, 0, SEEK_CUR) : -1;
+    const off_t page_byte_len = static_cast<off_t>(::sysconf(_SC_PAGESIZE));
+    const off_t map_offset = (offset >= 0) && (page_byte_len > 0) ? (offset - (offset % page_byte_len)) : 0;
+
+    const bool is_mappable = (offset >= 0) && (offset < st.st_size);
+    const size_t map_len = is_mappable ? static_cast<size_t>(st.st_size - map_offset) : 0;
+    void* mapped = is_mappable ? ::mmap(nullptr, map_len, PROT_READ, MAP_PRIVATE, fd, map_offset) : MAP_FAILED;
+
+    if (mapped != MAP_FAILED) {
+      const size_t skip_len = static_cast<size_t>(offset - map_offset);
+
+      ::madvise(mapped, map_len, MADV_SEQUENTIAL);
+      consume(std::span<const uint8_t>(static_cast<const uint8_t*>(mapped) + skip_len, map_len - skip_len));
+      ::munmap(mapped, map_len);
+
+      ::lseek(fd, st.st_size, SEEK_SET);
+      return ascon_file_status_t::processed_file;
+    }
+
+    if (method == ascon_file_read_method_t::mmap) {
+      // Nothing is left to be mapped, past current offset of a regular file e.g. it's empty, but it's still fine to process it.
+      if ((offset >= 0) && (offset >= st.st_size)) {
+        return ascon_file_status_t::processed_file;
+      }
+      return ascon_file_status_t::failed_to_map_file;
+    }
+  }
+
+  std::vector<uint8_t> buffer(READ_BUFFER_BYTE_LEN);
+
+  while (true) {
+    const ssize_t n = ::read(fd, buffer.data(), buffer.size());
+    if (n == 0) {
+      break;
+    }
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return ascon_file_status_t::failed_to_read_file;
+    }
+
+    consume(std::span<const uint8_t>(buffer.data(), static_cast<size_t>(n)));
+  }
+
+  return ascon_file_status_t::processed_file;
+}
+
+/**
+ * @brief Computes Ascon-Hash256 digest of content of an open file descriptor, from its current offset till end. See `stream_fd` for how content is accessed.
+ *
+ * @param fd Open, readable file descriptor. It's not closed.
+ * @param digest Computed digest.
+ * @param method How to access content of the file.
+ * @return An `ascon_file_status_t` indicating the status of the operation. Digest is valid only when it's `processed_file`.
+ */
+[[nodiscard]]
+inline ascon_file_status_t
+hash_fd(const int fd, std::span<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest, const ascon_file_read_method_t method = ascon_file_read_method_t::automatic)
+{
+  ascon_hash256::ascon_hash256_t hasher;
+
+  const auto status = stream_fd(fd, method, [&](std::span<const uint8_t> bytes) { (void)hasher.absorb(bytes); });
+  if (status != ascon_file_status_t::processed_file) {
+    return status;
+  }
+
+  (void)hasher.finalize();
+  (void)hasher.digest(digest);
+
+  return ascon_file_status_t::processed_file;
+}
+
+/**
+ * @brief Computes Ascon-Hash256 digest of a file. Regular files are memory mapped, by default, while others e.g. pipes are read piece by piece.
+ *
+ * @param path Path to the file.
+ * @param digest Computed digest.
+ * @param method How to access content of the file.
+ * @return An `ascon_file_status_t` indicating the status of the operation. Digest is valid only when it's `processed_file`.
+ */
+[[nodiscard]]
+inline ascon_file_status_t
+hash_file(const char* path,
+          std::span<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest,
+          const ascon_file_read_method_t method = ascon_file_read_method_t::automatic)
+{
+  const int fd = open_file(path, O_RDONLY);
+  if (fd < 0) {
+    return ascon_file_status_t::failed_to_open_file;
+  }
+
+  const auto status = hash_fd(fd, digest, method);
+  ::close(fd);
+
+  return status;
+}
+
+}
@@ -0,0 +1,157 @@
+#pragma once
+#include "ascon/utils/force_inline.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Opt-in instrumentation of hot paths, for attributing cost of Ascon in production e.g. to see whether most of it goes into initialization permutations of
+// tiny packets, rather than into bulk data. Define `ASCON_ENABLE_INSTRUMENTATION` for all translation units, to count, per thread, permutation calls of each
+// round count, along with full/ partial blocks and bytes processed in each phase of sponge and duplex modes. Without it, recording functions are empty and
+// compile to nothing, while `snapshot` always returns zeroed counters.
+namespace ascon_instrumentation {
+
+#if defined(ASCON_ENABLE_INSTRUMENTATION)
+static constexpr bool is_enabled = true;
+#else
+static constexpr bool is_enabled = false;
+#endif
+
+// Maximum number of rounds of Ascon permutation, same as `ascon_perm::ASCON_PERMUTATION_MAX_ROUNDS`.
+static constexpr size_t MAX_ROUNDS = 16;
+
+// Phases of sponge and duplex modes, in which blocks of data are processed.
+enum class phase_t : uint8_t
+{
+  hash_absorb = 0,      // Message (or customization string) absorption, in Ascon-Hash256/ XOF128/ CXOF128
+  hash_squeeze,         // Digest/ output extraction, in Ascon-Hash256/ XOF128/ CXOF128
+  aead_associated_data, // Associated data absorption, in Ascon-AEAD128
+  aead_encrypt,         // Plaintext encryption, in Ascon-AEAD128
+  aead_decrypt,         // Ciphertext decryption, in Ascon-AEAD128
+};
+
+static constexpr size_t PHASE_COUNT = static_cast<size_t>(phase_t::aead_decrypt) + 1;
+
+struct phase_counters_t
+{
+  uint64_t full_blocks = 0;    // Rate-sized blocks
+  uint64_t partial_blocks = 0; // Blocks shorter than rate i.e. head of a message continuing a partially processed block, or its tail
+  uint64_t bytes = 0;
+};
+
+// Point-in-time copy of counters of a thread.
+struct ascon_instrumentation_snapshot_t
+{
+  std::array<uint64_t, MAX_ROUNDS + 1> permutations{}; // Number of permutation calls, indexed by their round count
+  std::array<phase_counters_t, PHASE_COUNT> phases{};
+
+  [[nodiscard]]
+  constexpr const phase_counters_t& operator[](const phase_t phase) const
+  {
+    return phases[static_cast<size_t>(phase)];
+  }
+  [[nodiscard]]
+  constexpr phase_counters_t& operator[](const phase_t phase)
+  {
+    return phases[static_cast<size_t>(phase)];
+  }
+
+  [[nodiscard]]
+  constexpr uint64_t total_permutations() const
+  {
+    uint64_t total = 0;
+    for (const auto count : permutations) {
+      total += count;
+    }
+    return total;
+  }
+
+  // Total number of permutation rounds executed, which is what cost is proportional to.
+  [[nodiscard]]
+  constexpr uint64_t total_rounds() const
+  {
+    uint64_t total = 0;
+    for (size_t r = 0; r < permutations.size(); r++) {
+      total += permutations[r] * r;
+    }
+    return total;
+  }
+
+  // Accumulates counters of another snapshot e.g. for aggregating snapshots taken on different threads.
+  constexpr ascon_instrumentation_snapshot_t& operator+=(const ascon_instrumentation_snapshot_t& rhs)
+  {
+    for (size_t r = 0; r < permutations.size(); r++) {
+      permutations[r] += rhs.permutations[r];
+    }
+    for (size_t p = 0; p < phases.size(); p++) {
+      phases[p].full_blocks += rhs.phases[p].full_blocks;
+      phases[p].partial_blocks += rhs.phases[p].partial_blocks;
+      phases[p].bytes += rhs.phases[p].bytes;
+    }
+    return *this;
+  }
+};
+
+#if defined(ASCON_ENABLE_INSTRUMENTATION)
+// Counters of calling thread, only ever touched by it, so that recording needs neither atomics nor locking.
+inline thread_local ascon_instrumentation_snapshot_t thread_counters{};
+#endif
+
+// Records `count` -many calls of R -rounds Ascon permutation. Calls made during constant evaluation e.g. for computing initial states of hashing schemes, cost
+// nothing at run-time, so they are not counted.
+template<const size_t R>
+  requires(R <= MAX_ROUNDS)
+forceinline constexpr void
+record_permutation(const uint64_t count = 1)
+{
+#if defined(ASCON_ENABLE_INSTRUMENTATION)
+  if (!std::is_constant_evaluated()) {
+    thread_counters.permutations[R] += count;
+  }
+#else
+  (void)count;
+#endif
+}
+
+// Records full and partial blocks, along with number of bytes, processed in given phase.
+forceinline constexpr void
+record_blocks(const phase_t phase, const uint64_t full_blocks, const uint64_t partial_blocks, const uint64_t bytes)
+{
+#if defined(ASCON_ENABLE_INSTRUMENTATION)
+  if (!std::is_constant_evaluated()) {
+    auto& counters = thread_counters[phase];
+
+    counters.full_blocks += full_blocks;
+    counters.partial_blocks += partial_blocks;
+    counters.bytes += bytes;
+  }
+#else
+  (void)phase;
+  (void)full_blocks;
+  (void)partial_blocks;
+  (void)bytes;
+#endif
+}
+
+// Returns a copy of counters of calling thread. All zero, when instrumentation is not enabled.
+[[nodiscard]]
+inline ascon_instrumentation_snapshot_t
+snapshot()
+{
+#if defined(ASCON_ENABLE_INSTRUMENTATION)
+  return thread_counters;
+#else
+  return {};
+#endif
+}
+
+// Resets counters of calling thread to zero.
+inline void
+reset()
+{
+#if defined(ASCON_ENABLE_INSTRUMENTATION)
+  thread_counters = {};
+#endif
+}
+
+}
@@ -0,0 +1,181 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ascon_parallel {
+
+// Returns number of concurrent threads supported by the hardware, falling back to 1, when it can't be determined.
+[[nodiscard]]
+inline size_t
+default_thread_count()
+{
+  return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+/**
+ * @brief Fixed-size pool of persistent worker threads, for running `parallel_for` -style jobs, without paying for spawning and joining threads on every
+ * call. Ranges of a job are handed out dynamically, by bumping a shared atomic counter, so that faster threads pick up more work. Calling thread also
+ * participates in each job. Jobs are run one at a time; submitting a job from multiple threads is serialized, while submitting one from inside a running job,
+ * of the same pool, deadlocks.
+ */
+struct thread_pool_t
+{
+private:
+  std::vector<std::thread> workers;
+
+  std::mutex job_mutex;
+  std::mutex state_mutex;
+  std::condition_variable job_available;
+  std::condition_variable job_done;
+
+  // Currently running job, guarded by `state_mutex`, except for `next_range`, which workers bump without holding the lock.
+  std::function<void(size_t, size_t)> job_fn;
+  size_t job_num_items = 0;
+  size_t job_range_len = 1;
+  size_t job_num_ranges = 0;
+  std::atomic<size_t> next_range{ 0 };
+
+  uint64_t job_generation = 0;
+  size_t num_busy_workers = 0;
+  bool is_stopping = false;
+
+  // Picks up ranges of current job, till none is left.
+  inline void run_ranges()
+  {
+    while (true) {
+      const size_t range_idx = next_range.fetch_add(1, std::memory_order_relaxed);
+      if (range_idx >= job_num_ranges) {
+        break;
+      }
+
+      const size_t begin = range_idx * job_range_len;
+      const size_t end = std::min(begin + job_range_len, job_num_items);
+
+      job_fn(begin, end);
+    }
+  }
+
+  inline void worker_loop()
+  {
+    uint64_t seen_generation = 0;
+
+    while (true) {
+      {
+        std::unique_lock lock(state_mutex);
+        job_available.wait(lock, [&]() { return is_stopping || (job_generation != seen_generation); });
+
+        if (is_stopping) {
+          return;
+        }
+
+        seen_generation = job_generation;
+        num_busy_workers++;
+      }
+
+      run_ranges();
+
+      {
+        std::lock_guard lock(state_mutex);
+        num_busy_workers--;
+      }
+      job_done.notify_all();
+    }
+  }
+
+public:
+  // Constructor(s)/ Destructor(s)
+
+  /**
+   * @brief Starts a pool, which runs jobs on `num_threads` threads, including the calling one i.e. `num_threads - 1` worker threads are spawned.
+   */
+  inline explicit thread_pool_t(const size_t num_threads = default_thread_count())
+  {
+    const size_t num_workers = std::max<size_t>(num_threads, 1) - 1;
+
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; i++) {
+      workers.emplace_back([this]() { worker_loop(); });
+    }
+  }
+
+  inline ~thread_pool_t()
+  {
+    {
+      std::lock_guard lock(state_mutex);
+      is_stopping = true;
+    }
+    job_available.notify_all();
+
+    for (auto& w : workers) {
+      w.join();
+    }
+  }
+
+  thread_pool_t(const thread_pool_t&) = delete;
+  thread_pool_t& operator=(const thread_pool_t&) = delete;
+
+  // Returns number of threads, jobs are run on, including the calling one.
+  [[nodiscard]]
+  inline size_t thread_count() const
+  {
+    return workers.size() + 1;
+  }
+
+  /**
+   * @brief Splits [0, num_items) into ranges of `grain` -many items (last one can be shorter) and runs `fn(begin, end)` on each of them, using all threads of
+   * the pool, including the calling one. Returns only after all ranges are processed.
+   */
+  template<typename F>
+  inline void parallel_for(const size_t num_items, const size_t grain, F&& fn)
+  {
+    if (num_items == 0) {
+      return;
+    }
+
+    std::lock_guard job_lock(job_mutex);
+
+    const size_t range_len = std::max<size_t>(grain, 1);
+
+    {
+      // A worker reads job description, without holding the lock, only while it's busy, so it's safe to replace it, once none of them is busy. A worker,
+      // which wakes up late for the previous job, finds no range left in it or simply joins this one.
+      std::unique_lock lock(state_mutex);
+      job_done.wait(lock, [&]() { return num_busy_workers == 0; });
+
+      job_fn = std::ref(fn);
+      job_num_items = num_items;
+      job_range_len = range_len;
+      job_num_ranges = (num_items + (range_len - 1)) / range_len;
+      next_range.store(0, std::memory_order_relaxed);
+
+      job_generation++;
+    }
+    job_available.notify_all();
+
+    run_ranges();
+
+    std::unique_lock lock(state_mutex);
+    job_done.wait(lock, [&]() { return num_busy_workers == 0; });
+    job_fn = nullptr;
+  }
+};
+
+/**
+ * @brief Returns the process-wide pool, running jobs on `default_thread_count()` threads, which is started on first use and stopped at program exit. Handy
+ * for callers, which don't need a pool of their own; jobs submitted to it, from different threads, are run one after another.
+ */
+[[nodiscard]]
+inline thread_pool_t&
+default_thread_pool()
+{
+  static thread_pool_t pool;
+  return pool;
+}
+
+}
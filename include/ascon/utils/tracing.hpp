@@ -0,0 +1,58 @@
+#pragma once
+#include "ascon/utils/force_inline.hpp"
+#include <cstdint>
+#include <type_traits>
+
+// Optional static tracepoints i.e. USDT probes, under provider `ascon`, around phases of Ascon-AEAD128, Ascon-Hash256, Ascon-XOF128 and Ascon-CXOF128, for
+// correlating latency spikes with them, using bpftrace or perf, on a running program. Define `ASCON_ENABLE_TRACING` to compile them in, which requires
+// <sys/sdt.h> e.g. from systemtap-sdt-dev. Each traced phase `P` fires probe `P_entry` when it's entered and `P_exit` when it returns, both carrying the
+// number of message/ data bytes it processes (0 for initialization and finalization), as their only argument. A probe site is a single `nop`, until a tracer
+// attaches to it. Without the macro, nothing is emitted.
+
+#if defined(ASCON_ENABLE_TRACING)
+
+#if !__has_include(<sys/sdt.h>)
+#error "ASCON_ENABLE_TRACING requires <sys/sdt.h>, install systemtap-sdt-dev (Debian/ Ubuntu) or systemtap-sdt-devel (Fedora)"
+#endif
+#include <sys/sdt.h>
+
+namespace ascon_tracing {
+
+// Invokes given function when going out of scope, so that the exit probe fires on each return path.
+template<typename F>
+struct scope_exit_t
+{
+  F fn;
+
+  forceinline constexpr explicit scope_exit_t(F f)
+    : fn(f)
+  {
+  }
+  forceinline constexpr ~scope_exit_t() { fn(); }
+};
+
+}
+
+#define ASCON_TRACE_CONCAT_IMPL(a, b) a##b
+#define ASCON_TRACE_CONCAT(a, b) ASCON_TRACE_CONCAT_IMPL(a, b)
+
+// Fires probe `name`, unless it's being evaluated during program compilation.
+#define ASCON_TRACE_PROBE(name, byte_len)                                                                                                                      \
+  do {                                                                                                                                                         \
+    if (!std::is_constant_evaluated()) {                                                                                                                       \
+      DTRACE_PROBE1(ascon, name, byte_len);                                                                                                                    \
+    }                                                                                                                                                          \
+  } while (false)
+
+// Fires probe `name_entry` right away and `name_exit` when enclosing scope is left.
+#define ASCON_TRACE_SCOPE(name, byte_len)                                                                                                                      \
+  const uint64_t ASCON_TRACE_CONCAT(ascon_trace_byte_len_, __LINE__) = static_cast<uint64_t>(byte_len);                                                        \
+  ASCON_TRACE_PROBE(name##_entry, ASCON_TRACE_CONCAT(ascon_trace_byte_len_, __LINE__));                                                                        \
+  const ascon_tracing::scope_exit_t ASCON_TRACE_CONCAT(ascon_trace_scope_, __LINE__)(                                                                          \
+    [&]() { ASCON_TRACE_PROBE(name##_exit, ASCON_TRACE_CONCAT(ascon_trace_byte_len_, __LINE__)); })
+
+#else
+
+#define ASCON_TRACE_SCOPE(name, byte_len)
+
+#endif
@@ -73,6 +73,18 @@ TEST(AsconAEAD128, KnownAnswerTests)
       EXPECT_TRUE(std::ranges::equal(ct_span.first(pt.size()), computed_ct));
       EXPECT_TRUE(std::ranges::equal(tag_span, computed_tag));
 
+      // One-shot, in-place encryption and decryption.
+      std::vector<uint8_t> buffer(ct.size());
+      auto buffer_span = std::span(buffer);
+      std::copy(pt.begin(), pt.end(), buffer.begin());
+
+      EXPECT_EQ(ascon_aead128::seal(key_span, nonce_span, ad, buffer_span.first(pt.size()), buffer_span), ascon_aead128::ascon_aead128_status_t::sealed);
+      EXPECT_EQ(buffer, ct);
+
+      EXPECT_EQ(ascon_aead128::open(key_span, nonce_span, ad, buffer_span, buffer_span.first(pt.size())),
+                ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+      EXPECT_TRUE(std::ranges::equal(buffer_span.first(pt.size()), pt));
+
       std::string empty_line;
       std::getline(file, empty_line);
     } else {
@@ -176,3 +188,103 @@ TEST(AsconAEAD128, ACVPKnownAnswerTests)
 
   file.close();
 }
+
+TEST(AsconAEAD128, BurstKnownAnswerTests)
+{
+  using namespace std::literals;
+
+  const std::string kat_file = "./kats/ascon_aead128.kat";
+  std::fstream file(kat_file);
+
+  std::vector<std::vector<uint8_t>> keys;
+  std::vector<std::vector<uint8_t>> nonces;
+  std::vector<std::vector<uint8_t>> pts;
+  std::vector<std::vector<uint8_t>> ads;
+  std::vector<std::vector<uint8_t>> cts; // cipher text + tag
+
+  while (true) {
+    std::string count0;
+
+    if (!std::getline(file, count0).eof()) {
+      std::string key0;
+      std::string nonce0;
+      std::string pt0;
+      std::string ad0;
+      std::string ct0;
+
+      std::getline(file, key0);
+      std::getline(file, nonce0);
+      std::getline(file, pt0);
+      std::getline(file, ad0);
+      std::getline(file, ct0);
+
+      auto key1 = std::string_view(key0);
+      auto nonce1 = std::string_view(nonce0);
+      auto pt1 = std::string_view(pt0);
+      auto ad1 = std::string_view(ad0);
+      auto ct1 = std::string_view(ct0);
+
+      auto key2 = key1.substr(key1.find("="sv) + 2, key1.size());
+      auto nonce2 = nonce1.substr(nonce1.find("="sv) + 2, nonce1.size());
+      auto pt2 = ((pt1.find("="sv) + 2) > pt1.size()) ? ""sv : pt1.substr(pt1.find("="sv) + 2, pt1.size());
+      auto ad2 = ((ad1.find("="sv) + 2) > ad1.size()) ? ""sv : ad1.substr(ad1.find("="sv) + 2, ad1.size());
+      auto ct2 = ct1.substr(ct1.find("="sv) + 2, ct1.size());
+
+      keys.push_back(hex_to_bytes(key2));
+      nonces.push_back(hex_to_bytes(nonce2));
+      pts.push_back(hex_to_bytes(pt2));
+      ads.push_back(hex_to_bytes(ad2));
+      cts.push_back(hex_to_bytes(ct2));
+
+      std::string empty_line;
+      std::getline(file, empty_line);
+    } else {
+      break;
+    }
+  }
+
+  file.close();
+
+  const size_t num_packets = keys.size();
+
+  std::vector<std::vector<uint8_t>> computed_cts(num_packets);
+  std::vector<std::vector<uint8_t>> computed_pts(num_packets);
+  std::vector<std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN>> computed_tags(num_packets);
+
+  std::vector<ascon_aead128::ascon_aead128_encrypt_packet_t> enc_packets;
+  std::vector<ascon_aead128::ascon_aead128_decrypt_packet_t> dec_packets;
+
+  for (size_t i = 0; i < num_packets; i++) {
+    computed_cts[i].resize(pts[i].size());
+    computed_pts[i].resize(pts[i].size());
+
+    auto key_span = std::span<const uint8_t, ascon_aead128::KEY_BYTE_LEN>(keys[i]);
+    auto nonce_span = std::span<const uint8_t, ascon_aead128::NONCE_BYTE_LEN>(nonces[i]);
+    auto tag_span = std::span<const uint8_t, ascon_aead128::TAG_BYTE_LEN>(std::span(cts[i]).last(ascon_aead128::TAG_BYTE_LEN));
+
+    enc_packets.push_back({ key_span, nonce_span, ads[i], pts[i], computed_cts[i], computed_tags[i] });
+    dec_packets.push_back({ key_span, nonce_span, ads[i], std::span(cts[i]).first(pts[i].size()), computed_pts[i], tag_span });
+  }
+
+  for_each_supported_perm_backend([&](const ascon_perm::ascon_perm_backend_t backend) {
+    SCOPED_TRACE(ascon_perm::backend_name(backend));
+
+    for (size_t i = 0; i < num_packets; i++) {
+      std::ranges::fill(computed_cts[i], 0);
+      std::ranges::fill(computed_pts[i], 0);
+      computed_tags[i].fill(0);
+    }
+
+    EXPECT_EQ(ascon_aead128::encrypt_burst(enc_packets), ascon_aead128::ascon_aead128_status_t::encrypted_burst);
+
+    std::vector<ascon_aead128::ascon_aead128_status_t> results(num_packets);
+    EXPECT_EQ(ascon_aead128::decrypt_burst(dec_packets, results), ascon_aead128::ascon_aead128_status_t::decrypted_burst);
+
+    for (size_t i = 0; i < num_packets; i++) {
+      EXPECT_TRUE(std::ranges::equal(std::span(cts[i]).first(pts[i].size()), computed_cts[i]));
+      EXPECT_TRUE(std::ranges::equal(std::span(cts[i]).last(ascon_aead128::TAG_BYTE_LEN), computed_tags[i]));
+      EXPECT_EQ(results[i], ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+      EXPECT_EQ(computed_pts[i], pts[i]);
+    }
+  });
+}
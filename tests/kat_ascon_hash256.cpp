@@ -48,6 +48,54 @@ ascon_hash256_KAT_runner(const std::string file_name)
   file.close();
 }
 
+// Same as above, but all messages of the KAT file are hashed in a single batch, using `hash_many`.
+static void
+ascon_hash256_batched_KAT_runner(const std::string file_name)
+{
+  using namespace std::literals;
+  std::fstream file(file_name);
+
+  std::vector<std::vector<uint8_t>> msgs;
+  std::vector<std::vector<uint8_t>> mds;
+
+  while (true) {
+    std::string count0;
+
+    if (!std::getline(file, count0).eof()) {
+      std::string msg0;
+      std::string md0;
+
+      std::getline(file, msg0);
+      std::getline(file, md0);
+
+      auto msg1 = std::string_view(msg0);
+      auto md1 = std::string_view(md0);
+
+      auto msg2 = msg1.substr(msg1.find("="sv) + 2, msg1.size());
+      auto md2 = md1.substr(md1.find("="sv) + 2, md1.size());
+
+      msgs.push_back(hex_to_bytes(msg2));
+      mds.push_back(hex_to_bytes(md2));
+
+      std::string empty_line;
+      std::getline(file, empty_line);
+    } else {
+      break;
+    }
+  }
+
+  file.close();
+
+  std::vector<std::span<const uint8_t>> msg_spans(msgs.begin(), msgs.end());
+  std::vector<std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN>> computed_mds(msgs.size());
+
+  EXPECT_EQ(ascon_hash256::hash_many(msg_spans, computed_mds), ascon_hash256::ascon_hash256_status_t::batch_message_digests_produced);
+
+  for (size_t i = 0; i < msgs.size(); i++) {
+    EXPECT_TRUE(std::ranges::equal(computed_mds[i], mds[i]));
+  }
+}
+
 TEST(AsconHash256, KnownAnswerTests)
 {
   ascon_hash256_KAT_runner("./kats/ascon_hash256.kat");
@@ -57,3 +105,13 @@ TEST(AsconHash256, ACVPKnownAnswerTests)
 {
   ascon_hash256_KAT_runner("./kats/ascon_hash256.acvp.kat");
 }
+
+TEST(AsconHash256, BatchedKnownAnswerTests)
+{
+  for_each_supported_perm_backend([](const ascon_perm::ascon_perm_backend_t backend) {
+    SCOPED_TRACE(ascon_perm::backend_name(backend));
+
+    ascon_hash256_batched_KAT_runner("./kats/ascon_hash256.kat");
+    ascon_hash256_batched_KAT_runner("./kats/ascon_hash256.acvp.kat");
+  });
+}
@@ -343,6 +343,305 @@ TEST(AsconAEAD128, ForSameCiphertextOneshotDecryptionAndIncrementalDecryptionPro
   }
 }
 
+// Encrypts and then decrypts a burst of random packets of ragged lengths, using burst API, checking that ciphertexts and tags match those produced by
+// `ascon_aead128_t`, and that per-packet tag verification result is reported correctly, when tags of every third packet are tampered with.
+template<const size_t LANES>
+static void
+test_burst_encryption_and_decryption(const size_t num_packets)
+{
+  std::vector<std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN>> keys(num_packets);
+  std::vector<std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN>> nonces(num_packets);
+  std::vector<std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN>> tags(num_packets);
+  std::vector<std::vector<uint8_t>> associated_data(num_packets);
+  std::vector<std::vector<uint8_t>> plaintexts(num_packets);
+  std::vector<std::vector<uint8_t>> ciphertexts(num_packets);
+  std::vector<std::vector<uint8_t>> decipheredtexts(num_packets);
+
+  std::vector<ascon_aead128::ascon_aead128_encrypt_packet_t> enc_packets;
+  std::vector<ascon_aead128::ascon_aead128_decrypt_packet_t> dec_packets;
+
+  for (size_t i = 0; i < num_packets; i++) {
+    std::array<uint8_t, 2> lens{};
+    generate_random_data<uint8_t>(lens);
+
+    associated_data[i].resize(lens[0] % (MAX_AD_LEN + 1));
+    plaintexts[i].resize(lens[1] % (MAX_PT_LEN + 1));
+    ciphertexts[i].resize(plaintexts[i].size());
+    decipheredtexts[i].resize(plaintexts[i].size());
+
+    generate_random_data<uint8_t>(keys[i]);
+    generate_random_data<uint8_t>(nonces[i]);
+    generate_random_data<uint8_t>(associated_data[i]);
+    generate_random_data<uint8_t>(plaintexts[i]);
+
+    enc_packets.push_back({ keys[i], nonces[i], associated_data[i], plaintexts[i], ciphertexts[i], tags[i] });
+    dec_packets.push_back({ keys[i], nonces[i], associated_data[i], ciphertexts[i], decipheredtexts[i], tags[i] });
+  }
+
+  EXPECT_EQ(ascon_aead128::encrypt_burst<LANES>(enc_packets), ascon_aead128::ascon_aead128_status_t::encrypted_burst);
+
+  for (size_t i = 0; i < num_packets; i++) {
+    std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN> tag{};
+    std::vector<uint8_t> ciphertext(plaintexts[i].size());
+
+    ascon_aead128::ascon_aead128_t enc_handle(keys[i], nonces[i]);
+    EXPECT_EQ(enc_handle.absorb_data(associated_data[i]), ascon_aead128::ascon_aead128_status_t::absorbed_data);
+    EXPECT_EQ(enc_handle.finalize_data(), ascon_aead128::ascon_aead128_status_t::finalized_data_absorption_phase);
+    EXPECT_EQ(enc_handle.encrypt_plaintext(plaintexts[i], ciphertext), ascon_aead128::ascon_aead128_status_t::encrypted_plaintext);
+    EXPECT_EQ(enc_handle.finalize_encrypt(tag), ascon_aead128::ascon_aead128_status_t::finalized_encryption_phase);
+
+    EXPECT_EQ(ciphertexts[i], ciphertext);
+    EXPECT_EQ(tags[i], tag);
+
+    if (i % 3 == 2) {
+      do_bitflip(tags[i]);
+    }
+  }
+
+  std::vector<ascon_aead128::ascon_aead128_status_t> results(num_packets);
+  EXPECT_EQ(ascon_aead128::decrypt_burst<LANES>(dec_packets, results), ascon_aead128::ascon_aead128_status_t::decrypted_burst);
+
+  for (size_t i = 0; i < num_packets; i++) {
+    if (i % 3 == 2) {
+      EXPECT_EQ(results[i], ascon_aead128::ascon_aead128_status_t::decryption_failure_due_to_tag_mismatch);
+      EXPECT_TRUE(std::ranges::all_of(decipheredtexts[i], [](const auto b) { return b == 0x00; }));
+    } else {
+      EXPECT_EQ(results[i], ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+      EXPECT_EQ(decipheredtexts[i], plaintexts[i]);
+    }
+  }
+}
+
+TEST(AsconAEAD128, BurstEncryptionAndDecryptionMatchesOneByOne)
+{
+  for (size_t num_packets = 0; num_packets <= 33; num_packets++) {
+    test_burst_encryption_and_decryption<1>(num_packets);
+    test_burst_encryption_and_decryption<2>(num_packets);
+    test_burst_encryption_and_decryption<4>(num_packets);
+    test_burst_encryption_and_decryption<8>(num_packets);
+    test_burst_encryption_and_decryption<ascon_perm::NATIVE_LANE_COUNT>(num_packets);
+  }
+}
+
+TEST(AsconAEAD128, BurstDecryptionWithMismatchingBatchSize)
+{
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN> tag{};
+  std::array<uint8_t, 16> ct{};
+  std::array<uint8_t, 16> pt{};
+
+  std::array<ascon_aead128::ascon_aead128_decrypt_packet_t, 1> packets{ { { key, nonce, {}, ct, pt, tag } } };
+  std::array<ascon_aead128::ascon_aead128_status_t, 2> results{};
+
+  EXPECT_EQ(ascon_aead128::decrypt_burst(packets, results), ascon_aead128::ascon_aead128_status_t::batch_size_mismatch);
+}
+
+TEST(AsconAEAD128, BurstWithMismatchingBufferLengthsIsRejected)
+{
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN> good_tag{};
+  std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN> bad_tag{};
+  std::array<uint8_t, 32> pt{};
+  std::array<uint8_t, 32> ct{};
+  std::array<uint8_t, 31> short_buf{};
+
+  generate_random_data<uint8_t>(pt);
+  generate_random_data<uint8_t>(ct);
+
+  // Well-formed packet comes first, so that it'd be processed, if lengths were checked lazily.
+  const std::array<ascon_aead128::ascon_aead128_encrypt_packet_t, 2> enc_packets{ {
+    { key, nonce, {}, pt, ct, good_tag },
+    { key, nonce, {}, pt, short_buf, bad_tag },
+  } };
+  const auto ct_before = ct;
+
+  EXPECT_EQ(ascon_aead128::encrypt_burst(enc_packets), ascon_aead128::ascon_aead128_status_t::buffer_length_mismatch);
+  EXPECT_EQ(ct, ct_before);
+  EXPECT_TRUE(std::ranges::all_of(good_tag, [](const uint8_t b) { return b == 0; }));
+
+  const std::array<ascon_aead128::ascon_aead128_decrypt_packet_t, 2> dec_packets{ {
+    { key, nonce, {}, ct, pt, good_tag },
+    { key, nonce, {}, ct, short_buf, bad_tag },
+  } };
+  const auto pt_before = pt;
+  std::array<ascon_aead128::ascon_aead128_status_t, 2> results{};
+
+  EXPECT_EQ(ascon_aead128::decrypt_burst(dec_packets, results), ascon_aead128::ascon_aead128_status_t::buffer_length_mismatch);
+  EXPECT_EQ(pt, pt_before);
+}
+
+TEST(AsconAEAD128, KeyContextMatchesKeyBytes)
+{
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  generate_random_data<uint8_t>(key);
+
+  // Same key context is reused across many messages, each under a distinct nonce.
+  const ascon_aead128::ascon_aead128_key_t key_ctx(key);
+
+  for (size_t associated_data_len = MIN_AD_LEN; associated_data_len <= MAX_AD_LEN; associated_data_len++) {
+    for (size_t plaintext_len = MIN_PT_LEN; plaintext_len <= MAX_PT_LEN; plaintext_len++) {
+      std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+      std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN> tag_a{};
+      std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN> tag_b{};
+      std::vector<uint8_t> associated_data(associated_data_len);
+      std::vector<uint8_t> plaintext(plaintext_len);
+      std::vector<uint8_t> ciphertext_a(plaintext_len);
+      std::vector<uint8_t> ciphertext_b(plaintext_len);
+      std::vector<uint8_t> decipheredtext(plaintext_len);
+
+      generate_random_data<uint8_t>(nonce);
+      generate_random_data<uint8_t>(associated_data);
+      generate_random_data<uint8_t>(plaintext);
+
+      ascon_aead128::ascon_aead128_t enc_handle_a(key, nonce);
+      EXPECT_EQ(enc_handle_a.absorb_data(associated_data), ascon_aead128::ascon_aead128_status_t::absorbed_data);
+      EXPECT_EQ(enc_handle_a.finalize_data(), ascon_aead128::ascon_aead128_status_t::finalized_data_absorption_phase);
+      EXPECT_EQ(enc_handle_a.encrypt_plaintext(plaintext, ciphertext_a), ascon_aead128::ascon_aead128_status_t::encrypted_plaintext);
+      EXPECT_EQ(enc_handle_a.finalize_encrypt(tag_a), ascon_aead128::ascon_aead128_status_t::finalized_encryption_phase);
+
+      ascon_aead128::ascon_aead128_t enc_handle_b(key_ctx, nonce);
+      EXPECT_EQ(enc_handle_b.absorb_data(associated_data), ascon_aead128::ascon_aead128_status_t::absorbed_data);
+      EXPECT_EQ(enc_handle_b.finalize_data(), ascon_aead128::ascon_aead128_status_t::finalized_data_absorption_phase);
+      EXPECT_EQ(enc_handle_b.encrypt_plaintext(plaintext, ciphertext_b), ascon_aead128::ascon_aead128_status_t::encrypted_plaintext);
+      EXPECT_EQ(enc_handle_b.finalize_encrypt(tag_b), ascon_aead128::ascon_aead128_status_t::finalized_encryption_phase);
+
+      EXPECT_EQ(ciphertext_a, ciphertext_b);
+      EXPECT_EQ(tag_a, tag_b);
+
+      ascon_aead128::ascon_aead128_t dec_handle(key_ctx, nonce);
+      EXPECT_EQ(dec_handle.absorb_data(associated_data), ascon_aead128::ascon_aead128_status_t::absorbed_data);
+      EXPECT_EQ(dec_handle.finalize_data(), ascon_aead128::ascon_aead128_status_t::finalized_data_absorption_phase);
+      EXPECT_EQ(dec_handle.decrypt_ciphertext(ciphertext_b, decipheredtext), ascon_aead128::ascon_aead128_status_t::decrypted_ciphertext);
+      EXPECT_EQ(dec_handle.finalize_decrypt(tag_b), ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+
+      EXPECT_EQ(plaintext, decipheredtext);
+    }
+  }
+}
+
+TEST(AsconAEAD128, OneshotSealAndOpenMatchesIncremental)
+{
+  for (size_t associated_data_len = MIN_AD_LEN; associated_data_len <= MAX_AD_LEN; associated_data_len++) {
+    for (size_t plaintext_len = MIN_PT_LEN; plaintext_len <= MAX_PT_LEN; plaintext_len++) {
+      std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+      std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+      std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN> tag{};
+      std::vector<uint8_t> associated_data(associated_data_len);
+      std::vector<uint8_t> plaintext(plaintext_len);
+      std::vector<uint8_t> ciphertext(plaintext_len);
+      std::vector<uint8_t> ciphertext_and_tag(plaintext_len + ascon_aead128::TAG_BYTE_LEN);
+      std::vector<uint8_t> decipheredtext(plaintext_len);
+
+      generate_random_data<uint8_t>(key);
+      generate_random_data<uint8_t>(nonce);
+      generate_random_data<uint8_t>(associated_data);
+      generate_random_data<uint8_t>(plaintext);
+
+      ascon_aead128::ascon_aead128_t enc_handle(key, nonce);
+      EXPECT_EQ(enc_handle.absorb_data(associated_data), ascon_aead128::ascon_aead128_status_t::absorbed_data);
+      EXPECT_EQ(enc_handle.finalize_data(), ascon_aead128::ascon_aead128_status_t::finalized_data_absorption_phase);
+      EXPECT_EQ(enc_handle.encrypt_plaintext(plaintext, ciphertext), ascon_aead128::ascon_aead128_status_t::encrypted_plaintext);
+      EXPECT_EQ(enc_handle.finalize_encrypt(tag), ascon_aead128::ascon_aead128_status_t::finalized_encryption_phase);
+
+      // Out-of-place seal, using key bytes
+      EXPECT_EQ(ascon_aead128::seal(key, nonce, associated_data, plaintext, ciphertext_and_tag), ascon_aead128::ascon_aead128_status_t::sealed);
+      EXPECT_TRUE(std::ranges::equal(std::span(ciphertext_and_tag).first(plaintext_len), ciphertext));
+      EXPECT_TRUE(std::ranges::equal(std::span(ciphertext_and_tag).last(ascon_aead128::TAG_BYTE_LEN), tag));
+
+      // In-place seal, using key context
+      const ascon_aead128::ascon_aead128_key_t key_ctx(key);
+
+      std::vector<uint8_t> buffer(ciphertext_and_tag.size());
+      auto buffer_span = std::span(buffer);
+      std::copy(plaintext.begin(), plaintext.end(), buffer.begin());
+
+      EXPECT_EQ(ascon_aead128::seal(key_ctx, nonce, associated_data, buffer_span.first(plaintext_len), buffer_span),
+                ascon_aead128::ascon_aead128_status_t::sealed);
+      EXPECT_EQ(buffer, ciphertext_and_tag);
+
+      // Out-of-place open
+      EXPECT_EQ(ascon_aead128::open(key, nonce, associated_data, ciphertext_and_tag, decipheredtext),
+                ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+      EXPECT_EQ(decipheredtext, plaintext);
+
+      // In-place open
+      EXPECT_EQ(ascon_aead128::open(key_ctx, nonce, associated_data, buffer_span, buffer_span.first(plaintext_len)),
+                ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+      EXPECT_TRUE(std::ranges::equal(buffer_span.first(plaintext_len), plaintext));
+
+      // In-place open, of tampered tag, must wipe decrypted plaintext
+      std::copy(ciphertext_and_tag.begin(), ciphertext_and_tag.end(), buffer.begin());
+      do_bitflip(buffer_span.last(ascon_aead128::TAG_BYTE_LEN));
+
+      EXPECT_EQ(ascon_aead128::open(key_ctx, nonce, associated_data, buffer_span, buffer_span.first(plaintext_len)),
+                ascon_aead128::ascon_aead128_status_t::decryption_failure_due_to_tag_mismatch);
+      EXPECT_TRUE(std::ranges::all_of(buffer_span.first(plaintext_len), [](const uint8_t byte) { return byte == 0; }));
+    }
+  }
+}
+
+// Encrypts plaintext, producing ciphertext followed by tag, by driving duplex mode directly with given permutation state representation.
+template<ascon_perm::ascon_perm_state perm_t>
+static void
+encrypt_with_state_representation(std::span<const uint8_t, ascon_aead128::KEY_BYTE_LEN> key,
+                                  std::span<const uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce,
+                                  std::span<const uint8_t> associated_data,
+                                  std::span<const uint8_t> plaintext,
+                                  std::span<uint8_t> ciphertext_and_tag)
+{
+  perm_t state;
+  size_t offset = 0;
+
+  ascon_duplex_mode::initialize(state, key, nonce);
+  ascon_duplex_mode::absorb_associated_data(state, offset, associated_data);
+  ascon_duplex_mode::finalize_associated_data(state, offset, associated_data.size());
+  ascon_duplex_mode::encrypt_plaintext(state, offset, plaintext, ciphertext_and_tag.first(plaintext.size()));
+  ascon_duplex_mode::finalize_ciphering(state, offset);
+  ascon_duplex_mode::finalize(state, key, ciphertext_and_tag.last<ascon_aead128::TAG_BYTE_LEN>());
+}
+
+TEST(AsconAEAD128, DuplexModeWorksWithAnyStateRepresentation)
+{
+  for (size_t associated_data_len = MIN_AD_LEN; associated_data_len <= MAX_AD_LEN; associated_data_len++) {
+    for (size_t plaintext_len = MIN_PT_LEN; plaintext_len <= MAX_PT_LEN; plaintext_len++) {
+      std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+      std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+      std::vector<uint8_t> associated_data(associated_data_len);
+      std::vector<uint8_t> plaintext(plaintext_len);
+      std::vector<uint8_t> expected(plaintext_len + ascon_aead128::TAG_BYTE_LEN);
+      std::vector<uint8_t> computed(plaintext_len + ascon_aead128::TAG_BYTE_LEN);
+
+      generate_random_data<uint8_t>(key);
+      generate_random_data<uint8_t>(nonce);
+      generate_random_data<uint8_t>(associated_data);
+      generate_random_data<uint8_t>(plaintext);
+
+      EXPECT_EQ(ascon_aead128::seal(key, nonce, associated_data, plaintext, expected), ascon_aead128::ascon_aead128_status_t::sealed);
+
+      encrypt_with_state_representation<ascon_perm::ascon_perm_u64_t>(key, nonce, associated_data, plaintext, computed);
+      EXPECT_EQ(computed, expected);
+
+      encrypt_with_state_representation<ascon_perm::ascon_perm_bi32_t>(key, nonce, associated_data, plaintext, computed);
+      EXPECT_EQ(computed, expected);
+    }
+  }
+}
+
+TEST(AsconAEAD128, OneshotSealAndOpenWithMismatchingBufferLength)
+{
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  std::array<uint8_t, 16> pt{};
+  std::array<uint8_t, 16 + ascon_aead128::TAG_BYTE_LEN> ct_and_tag{};
+
+  EXPECT_EQ(ascon_aead128::seal(key, nonce, {}, pt, std::span(ct_and_tag).first(16)), ascon_aead128::ascon_aead128_status_t::buffer_length_mismatch);
+  EXPECT_EQ(ascon_aead128::open(key, nonce, {}, ct_and_tag, std::span(pt).first(15)), ascon_aead128::ascon_aead128_status_t::buffer_length_mismatch);
+  EXPECT_EQ(ascon_aead128::open(key, nonce, {}, std::span(ct_and_tag).first(ascon_aead128::TAG_BYTE_LEN - 1), std::span<uint8_t>{}),
+            ascon_aead128::ascon_aead128_status_t::buffer_length_mismatch);
+}
+
 static ascon_aead128::ascon_aead128_t
 get_new_aead_instance()
 {
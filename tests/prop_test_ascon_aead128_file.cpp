@@ -0,0 +1,311 @@
+#include "ascon/aead/ascon_aead128_file.hpp"
+#include "ascon/aead/ascon_aead128_stream.hpp"
+#include "ascon/utils/thread_pool.hpp"
+#include "test_helper.hpp"
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+static constexpr size_t SEGMENT_BYTE_LEN = 64;
+static constexpr size_t S = SEGMENT_BYTE_LEN;
+static constexpr std::array<size_t, 8> PLAINTEXT_LENS = { 0, 1, S - 1, S, S + 1, 5 * S + 3, 16 * S, 37 * S + 17 };
+
+// Reads whole content of a file.
+static std::vector<uint8_t>
+read_file(const std::string& path)
+{
+  struct stat st{};
+  EXPECT_EQ(::stat(path.c_str(), &st), 0);
+
+  std::vector<uint8_t> bytes(static_cast<size_t>(st.st_size));
+
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  EXPECT_GE(fd, 0);
+
+  size_t off = 0;
+  while (off < bytes.size()) {
+    const ssize_t n = ::read(fd, bytes.data() + off, bytes.size() - off);
+    if (n <= 0) {
+      ADD_FAILURE() << "failed to read " << path;
+      bytes.resize(off);
+      break;
+    }
+
+    off += static_cast<size_t>(n);
+  }
+
+  ::close(fd);
+  return bytes;
+}
+
+TEST(AsconThreadPool, RunsEachItemOfManyJobsExactlyOnce)
+{
+  for (const size_t num_threads : { 1, 2, 5 }) {
+    ascon_parallel::thread_pool_t pool(num_threads);
+    EXPECT_EQ(pool.thread_count(), num_threads);
+
+    for (size_t job = 0; job < 200; job++) {
+      const size_t num_items = job % 37;
+      const size_t grain = (job % 5) + 1;
+
+      std::vector<std::atomic<uint32_t>> visits(num_items);
+
+      pool.parallel_for(num_items, grain, [&](const size_t begin, const size_t end) {
+        EXPECT_LE(end - begin, grain);
+        for (size_t i = begin; i < end; i++) {
+          visits[i].fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+
+      EXPECT_TRUE(std::ranges::all_of(visits, [](const auto& v) { return v.load() == 1; }));
+    }
+  }
+}
+
+TEST(AsconAEAD128File, DetachedEncryptionProducesSameCiphertextAndTagsAsStream)
+{
+  std::array<uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::array<uint8_t, 13> associated_data{};
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(associated_data);
+
+  ascon_parallel::thread_pool_t pool(3);
+
+  for (const size_t pt_byte_len : PLAINTEXT_LENS) {
+    std::vector<uint8_t> plaintext(pt_byte_len);
+    generate_random_data<uint8_t>(plaintext);
+
+    std::vector<uint8_t> stream(ascon_aead128_stream::encrypted_stream_byte_len(pt_byte_len, SEGMENT_BYTE_LEN));
+    EXPECT_EQ(ascon_aead128_stream::encrypt(pool, key, nonce_prefix, associated_data, plaintext, stream, SEGMENT_BYTE_LEN),
+              ascon_aead128_stream::ascon_aead128_stream_status_t::encrypted_stream);
+
+    const size_t num_segments = ascon_aead128_stream::segment_count(pt_byte_len, SEGMENT_BYTE_LEN);
+
+    // In-place encryption, over a copy of the plaintext
+    std::vector<uint8_t> buffer = plaintext;
+    std::vector<uint8_t> tags(num_segments * ascon_aead128_stream::TAG_BYTE_LEN);
+
+    EXPECT_EQ(ascon_aead128_stream::encrypt_detached<4>(pool, key, nonce_prefix, associated_data, buffer, buffer, tags, SEGMENT_BYTE_LEN),
+              ascon_aead128_stream::ascon_aead128_stream_status_t::encrypted_stream);
+
+    for (size_t i = 0; i < num_segments; i++) {
+      const size_t offset = i * SEGMENT_BYTE_LEN;
+      const size_t seg_byte_len = std::min(SEGMENT_BYTE_LEN, pt_byte_len - offset);
+      const auto encrypted_segment = std::span(stream).subspan(i * (SEGMENT_BYTE_LEN + ascon_aead128_stream::TAG_BYTE_LEN),
+                                                               seg_byte_len + ascon_aead128_stream::TAG_BYTE_LEN);
+
+      EXPECT_TRUE(std::ranges::equal(encrypted_segment.first(seg_byte_len), std::span(buffer).subspan(offset, seg_byte_len)));
+      EXPECT_TRUE(std::ranges::equal(encrypted_segment.last(ascon_aead128_stream::TAG_BYTE_LEN),
+                                     std::span(tags).subspan(i * ascon_aead128_stream::TAG_BYTE_LEN, ascon_aead128_stream::TAG_BYTE_LEN)));
+    }
+
+    // In-place decryption
+    EXPECT_EQ(ascon_aead128_stream::decrypt_detached<4>(pool, key, nonce_prefix, associated_data, buffer, tags, buffer, SEGMENT_BYTE_LEN),
+              ascon_aead128_stream::ascon_aead128_stream_status_t::decrypted_stream);
+    EXPECT_EQ(buffer, plaintext);
+  }
+}
+
+TEST(AsconAEAD128File, BufferEncryptionAndDecryption)
+{
+  std::array<uint8_t, ascon_aead128_file::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_file::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::array<uint8_t, 5> associated_data{};
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(associated_data);
+
+  for (const size_t num_threads : { 1, 4 }) {
+    ascon_parallel::thread_pool_t pool(num_threads);
+
+    for (const size_t pt_byte_len : PLAINTEXT_LENS) {
+      std::vector<uint8_t> plaintext(pt_byte_len);
+      generate_random_data<uint8_t>(plaintext);
+
+      std::vector<uint8_t> encrypted(ascon_aead128_file::encrypted_byte_len(pt_byte_len, SEGMENT_BYTE_LEN));
+      EXPECT_EQ(ascon_aead128_file::encrypt(pool, key, nonce_prefix, associated_data, plaintext, encrypted, SEGMENT_BYTE_LEN),
+                ascon_aead128_file::ascon_aead128_file_status_t::encrypted);
+
+      ascon_aead128_file::ascon_aead128_file_header_t header{};
+      EXPECT_EQ(ascon_aead128_file::parse_header(encrypted, header), ascon_aead128_file::ascon_aead128_file_status_t::parsed_header);
+      EXPECT_EQ(header.nonce_prefix, nonce_prefix);
+      EXPECT_EQ(header.segment_byte_len, SEGMENT_BYTE_LEN);
+      EXPECT_EQ(header.plaintext_byte_len, pt_byte_len);
+
+      std::vector<uint8_t> decrypted(pt_byte_len);
+      EXPECT_EQ(ascon_aead128_file::decrypt(pool, key, associated_data, encrypted, decrypted), ascon_aead128_file::ascon_aead128_file_status_t::decrypted);
+      EXPECT_EQ(decrypted, plaintext);
+
+      // Flipping a bit anywhere in the header, tags or ciphertext must be detected
+      auto tampered = encrypted;
+      const size_t bit_idx = (static_cast<size_t>(tampered[tampered.size() / 2]) * 131 + pt_byte_len) % (tampered.size() * 8);
+      tampered[bit_idx / 8] ^= static_cast<uint8_t>(1u << (bit_idx % 8));
+
+      ascon_aead128_file::ascon_aead128_file_header_t tampered_header{};
+      if (ascon_aead128_file::parse_header(tampered, tampered_header) == ascon_aead128_file::ascon_aead128_file_status_t::parsed_header) {
+        std::vector<uint8_t> tampered_decrypted(tampered_header.plaintext_byte_len);
+        EXPECT_EQ(ascon_aead128_file::decrypt(pool, key, associated_data, tampered, tampered_decrypted),
+                  ascon_aead128_file::ascon_aead128_file_status_t::decryption_failure_due_to_tag_mismatch);
+        EXPECT_TRUE(std::ranges::all_of(tampered_decrypted, [](const auto b) { return b == 0x00; }));
+      } else {
+        EXPECT_EQ(ascon_aead128_file::decrypt(pool, key, associated_data, tampered, decrypted),
+                  ascon_aead128_file::ascon_aead128_file_status_t::malformed_header);
+      }
+
+      // Associated data must match
+      EXPECT_EQ(ascon_aead128_file::decrypt(pool, key, {}, encrypted, decrypted),
+                ascon_aead128_file::ascon_aead128_file_status_t::decryption_failure_due_to_tag_mismatch);
+    }
+  }
+}
+
+TEST(AsconAEAD128File, MalformedHeaderOrMismatchingBuffers)
+{
+  std::array<uint8_t, ascon_aead128_file::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_file::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::vector<uint8_t> plaintext(3 * SEGMENT_BYTE_LEN + 1);
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(plaintext);
+
+  ascon_parallel::thread_pool_t pool(2);
+
+  std::vector<uint8_t> encrypted(ascon_aead128_file::encrypted_byte_len(plaintext.size(), SEGMENT_BYTE_LEN));
+  std::vector<uint8_t> decrypted(plaintext.size());
+
+  EXPECT_EQ(ascon_aead128_file::encrypt(pool, key, nonce_prefix, {}, plaintext, std::span(encrypted).first(encrypted.size() - 1), SEGMENT_BYTE_LEN),
+            ascon_aead128_file::ascon_aead128_file_status_t::buffer_length_mismatch);
+  EXPECT_EQ(ascon_aead128_file::encrypt(pool, key, nonce_prefix, {}, plaintext, encrypted, 0),
+            ascon_aead128_file::ascon_aead128_file_status_t::buffer_length_mismatch);
+  EXPECT_EQ(ascon_aead128_file::encrypt(pool, key, nonce_prefix, {}, plaintext, encrypted, SEGMENT_BYTE_LEN),
+            ascon_aead128_file::ascon_aead128_file_status_t::encrypted);
+
+  // Truncated, extended or of unknown version
+  EXPECT_EQ(ascon_aead128_file::decrypt(pool, key, {}, std::span(encrypted).first(ascon_aead128_file::FIXED_HEADER_BYTE_LEN - 1), {}),
+            ascon_aead128_file::ascon_aead128_file_status_t::malformed_header);
+  EXPECT_EQ(ascon_aead128_file::decrypt(pool, key, {}, std::span(encrypted).first(encrypted.size() - 1), decrypted),
+            ascon_aead128_file::ascon_aead128_file_status_t::malformed_header);
+
+  auto extended = encrypted;
+  extended.push_back(0x00);
+  EXPECT_EQ(ascon_aead128_file::decrypt(pool, key, {}, extended, decrypted), ascon_aead128_file::ascon_aead128_file_status_t::malformed_header);
+
+  auto unknown_version = encrypted;
+  unknown_version[0] ^= 0xff;
+  EXPECT_EQ(ascon_aead128_file::decrypt(pool, key, {}, unknown_version, decrypted), ascon_aead128_file::ascon_aead128_file_status_t::malformed_header);
+
+  EXPECT_EQ(ascon_aead128_file::decrypt(pool, key, {}, encrypted, std::span(decrypted).first(1)),
+            ascon_aead128_file::ascon_aead128_file_status_t::buffer_length_mismatch);
+}
+
+TEST(AsconAEAD128File, FileEncryptionAndDecryption)
+{
+  std::array<uint8_t, ascon_aead128_file::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_file::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+
+  ascon_parallel::thread_pool_t pool(3);
+
+  for (const size_t pt_byte_len : { size_t{ 0 }, size_t{ 1 }, 1'000 * SEGMENT_BYTE_LEN + 7 }) {
+    std::vector<uint8_t> plaintext(pt_byte_len);
+    generate_random_data<uint8_t>(plaintext);
+
+    const auto pt_path = write_temp_file(plaintext);
+    const auto enc_path = pt_path + ".enc";
+    const auto dec_path = pt_path + ".dec";
+
+    EXPECT_EQ(ascon_aead128_file::encrypt_file(pool, key, nonce_prefix, {}, pt_path.c_str(), enc_path.c_str(), SEGMENT_BYTE_LEN),
+              ascon_aead128_file::ascon_aead128_file_status_t::encrypted);
+
+    // Encrypted file is same as the encrypted buffer
+    auto encrypted = read_file(enc_path);
+    std::vector<uint8_t> expected(ascon_aead128_file::encrypted_byte_len(pt_byte_len, SEGMENT_BYTE_LEN));
+
+    EXPECT_EQ(ascon_aead128_file::encrypt(pool, key, nonce_prefix, {}, plaintext, expected, SEGMENT_BYTE_LEN),
+              ascon_aead128_file::ascon_aead128_file_status_t::encrypted);
+    EXPECT_EQ(encrypted, expected);
+
+    EXPECT_EQ(ascon_aead128_file::decrypt_file(pool, key, {}, enc_path.c_str(), dec_path.c_str()), ascon_aead128_file::ascon_aead128_file_status_t::decrypted);
+    EXPECT_EQ(read_file(dec_path), plaintext);
+
+    // Decrypted file is published with same permission bits as the encrypted one, not those of the owner-only temporary file
+    struct stat enc_st{};
+    struct stat dec_st{};
+    EXPECT_EQ(::stat(enc_path.c_str(), &enc_st), 0);
+    EXPECT_EQ(::stat(dec_path.c_str(), &dec_st), 0);
+    EXPECT_EQ(enc_st.st_mode & 0777, dec_st.st_mode & 0777);
+
+    // Tampered file leaves neither an existing output file modified, nor a new one (or a temporary one) behind
+    do_bitflip(std::span(encrypted).last(1));
+    ::unlink(enc_path.c_str());
+    const auto tampered_path = write_temp_file(encrypted);
+    const auto fresh_dec_path = pt_path + ".fresh.dec";
+
+    EXPECT_EQ(ascon_aead128_file::decrypt_file(pool, key, {}, tampered_path.c_str(), dec_path.c_str()),
+              ascon_aead128_file::ascon_aead128_file_status_t::decryption_failure_due_to_tag_mismatch);
+    EXPECT_EQ(read_file(dec_path), plaintext);
+
+    EXPECT_EQ(ascon_aead128_file::decrypt_file(pool, key, {}, tampered_path.c_str(), fresh_dec_path.c_str()),
+              ascon_aead128_file::ascon_aead128_file_status_t::decryption_failure_due_to_tag_mismatch);
+    EXPECT_FALSE(std::filesystem::exists(fresh_dec_path));
+
+    const auto pt_file_name = std::filesystem::path(pt_path).filename().string();
+    for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::path(pt_path).parent_path())) {
+      const auto file_name = entry.path().filename().string();
+      EXPECT_FALSE(file_name.starts_with(pt_file_name) && (file_name.find(".tmp-") != std::string::npos));
+    }
+
+    ::unlink(pt_path.c_str());
+    ::unlink(dec_path.c_str());
+    ::unlink(tampered_path.c_str());
+  }
+
+  EXPECT_EQ(ascon_aead128_file::encrypt_file(pool, key, nonce_prefix, {}, "/nonexistent/ascon/file", "/tmp/ascon_aead128_file_never_written"),
+            ascon_aead128_file::ascon_aead128_file_status_t::failed_to_open_file);
+
+  // Input file is never overwritten by its own output, be it under the same path or a hard link
+  {
+    std::vector<uint8_t> plaintext(3 * SEGMENT_BYTE_LEN + 1);
+    generate_random_data<uint8_t>(plaintext);
+
+    const auto pt_path = write_temp_file(plaintext);
+    const auto pt_link_path = pt_path + ".link";
+    const auto enc_path = pt_path + ".enc";
+    const auto enc_link_path = enc_path + ".link";
+
+    ASSERT_EQ(ascon_aead128_file::encrypt_file(pool, key, nonce_prefix, {}, pt_path.c_str(), enc_path.c_str(), SEGMENT_BYTE_LEN),
+              ascon_aead128_file::ascon_aead128_file_status_t::encrypted);
+    const auto encrypted = read_file(enc_path);
+
+    ASSERT_EQ(::link(pt_path.c_str(), pt_link_path.c_str()), 0);
+    ASSERT_EQ(::link(enc_path.c_str(), enc_link_path.c_str()), 0);
+
+    for (const auto& out_path : { pt_path, pt_link_path }) {
+      EXPECT_EQ(ascon_aead128_file::encrypt_file(pool, key, nonce_prefix, {}, pt_path.c_str(), out_path.c_str(), SEGMENT_BYTE_LEN),
+                ascon_aead128_file::ascon_aead128_file_status_t::same_input_and_output_file);
+      EXPECT_EQ(read_file(pt_path), plaintext);
+    }
+    for (const auto& out_path : { enc_path, enc_link_path }) {
+      EXPECT_EQ(ascon_aead128_file::decrypt_file(pool, key, {}, enc_path.c_str(), out_path.c_str()),
+                ascon_aead128_file::ascon_aead128_file_status_t::same_input_and_output_file);
+      EXPECT_EQ(read_file(enc_path), encrypted);
+    }
+
+    for (const auto& path : { pt_path, pt_link_path, enc_path, enc_link_path }) {
+      ::unlink(path.c_str());
+    }
+  }
+}
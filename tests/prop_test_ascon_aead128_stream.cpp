@@ -0,0 +1,271 @@
+#include "ascon/aead/ascon_aead128.hpp"
+#include "ascon/aead/ascon_aead128_stream.hpp"
+#include "test_helper.hpp"
+#include <array>
+#include <gtest/gtest.h>
+#include <vector>
+
+// Small segments, so that streams of many segments, with all kinds of last segment lengths, are cheap to test.
+static constexpr size_t SEGMENT_BYTE_LEN = 64;
+static constexpr size_t S = SEGMENT_BYTE_LEN;
+static constexpr std::array<size_t, 9> PLAINTEXT_LENS = { 0, 1, S - 1, S, S + 1, 2 * S, 5 * S + 3, 16 * S, 37 * S + 17 };
+
+// Encrypts plaintext, one segment at a time, using the online streaming encryptor.
+static std::vector<uint8_t>
+encrypt_one_segment_at_a_time(std::span<const uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key,
+                              std::span<const uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+                              std::span<const uint8_t> associated_data,
+                              std::span<const uint8_t> plaintext)
+{
+  std::vector<uint8_t> stream(ascon_aead128_stream::encrypted_stream_byte_len(plaintext.size(), SEGMENT_BYTE_LEN));
+  auto stream_span = std::span(stream);
+
+  ascon_aead128_stream::ascon_aead128_stream_encryptor_t encryptor(key, nonce_prefix, SEGMENT_BYTE_LEN);
+
+  const size_t num_segments = ascon_aead128_stream::segment_count(plaintext.size(), SEGMENT_BYTE_LEN);
+  for (size_t i = 0; i < num_segments; i++) {
+    const size_t offset = i * SEGMENT_BYTE_LEN;
+    const size_t pt_byte_len = std::min(SEGMENT_BYTE_LEN, plaintext.size() - offset);
+
+    EXPECT_EQ(encryptor.encrypt_segment(associated_data,
+                                        plaintext.subspan(offset, pt_byte_len),
+                                        stream_span.subspan(i * (SEGMENT_BYTE_LEN + ascon_aead128_stream::TAG_BYTE_LEN),
+                                                            pt_byte_len + ascon_aead128_stream::TAG_BYTE_LEN),
+                                        (i + 1) == num_segments),
+              ascon_aead128_stream::ascon_aead128_stream_status_t::encrypted_segment);
+  }
+
+  return stream;
+}
+
+template<const size_t LANES>
+static void
+test_stream_encryption_and_decryption(std::span<const uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key,
+                                      std::span<const uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix,
+                                      std::span<const uint8_t> associated_data,
+                                      std::span<const uint8_t> plaintext,
+                                      const std::vector<uint8_t>& expected_stream)
+{
+  for (const size_t num_threads : { 1, 3 }) {
+    ascon_parallel::thread_pool_t pool(num_threads);
+
+    std::vector<uint8_t> stream(expected_stream.size());
+    std::vector<uint8_t> decrypted(plaintext.size());
+
+    EXPECT_EQ(ascon_aead128_stream::encrypt<LANES>(pool, key, nonce_prefix, associated_data, plaintext, stream, SEGMENT_BYTE_LEN),
+              ascon_aead128_stream::ascon_aead128_stream_status_t::encrypted_stream);
+    EXPECT_EQ(stream, expected_stream);
+
+    EXPECT_EQ(ascon_aead128_stream::decrypt<LANES>(pool, key, nonce_prefix, associated_data, stream, decrypted, SEGMENT_BYTE_LEN),
+              ascon_aead128_stream::ascon_aead128_stream_status_t::decrypted_stream);
+    EXPECT_TRUE(std::ranges::equal(decrypted, plaintext));
+  }
+}
+
+TEST(AsconAEAD128Stream, ParallelAndOneSegmentAtATimeEncryptionProducesSameStream)
+{
+  std::array<uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::array<uint8_t, 19> associated_data{};
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(associated_data);
+
+  for (const size_t pt_byte_len : PLAINTEXT_LENS) {
+    std::vector<uint8_t> plaintext(pt_byte_len);
+    generate_random_data<uint8_t>(plaintext);
+
+    const auto expected_stream = encrypt_one_segment_at_a_time(key, nonce_prefix, associated_data, plaintext);
+
+    test_stream_encryption_and_decryption<1>(key, nonce_prefix, associated_data, plaintext, expected_stream);
+    test_stream_encryption_and_decryption<4>(key, nonce_prefix, associated_data, plaintext, expected_stream);
+    test_stream_encryption_and_decryption<8>(key, nonce_prefix, associated_data, plaintext, expected_stream);
+
+    // Online decryption, releasing one verified segment at a time
+    std::vector<uint8_t> decrypted(pt_byte_len);
+    ascon_aead128_stream::ascon_aead128_stream_decryptor_t decryptor(key, nonce_prefix, SEGMENT_BYTE_LEN);
+
+    const size_t num_segments = ascon_aead128_stream::segment_count(pt_byte_len, SEGMENT_BYTE_LEN);
+    for (size_t i = 0; i < num_segments; i++) {
+      const size_t offset = i * SEGMENT_BYTE_LEN;
+      const size_t segment_pt_byte_len = std::min(SEGMENT_BYTE_LEN, pt_byte_len - offset);
+
+      EXPECT_FALSE(decryptor.is_finalized());
+      EXPECT_EQ(decryptor.decrypt_segment(associated_data,
+                                          std::span(expected_stream)
+                                            .subspan(i * (SEGMENT_BYTE_LEN + ascon_aead128_stream::TAG_BYTE_LEN),
+                                                     segment_pt_byte_len + ascon_aead128_stream::TAG_BYTE_LEN),
+                                          std::span(decrypted).subspan(offset, segment_pt_byte_len),
+                                          (i + 1) == num_segments),
+                ascon_aead128_stream::ascon_aead128_stream_status_t::decrypted_segment);
+    }
+
+    EXPECT_TRUE(decryptor.is_finalized());
+    EXPECT_EQ(decrypted, plaintext);
+  }
+}
+
+TEST(AsconAEAD128Stream, EachSegmentIsAsconAEAD128UnderDerivedNonce)
+{
+  std::array<uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::vector<uint8_t> plaintext(2 * SEGMENT_BYTE_LEN + 5);
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(plaintext);
+
+  const auto stream = encrypt_one_segment_at_a_time(key, nonce_prefix, {}, plaintext);
+  const auto stream_span = std::span<const uint8_t>(stream);
+
+  for (size_t i = 0; i < 3; i++) {
+    std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+    std::copy(nonce_prefix.begin(), nonce_prefix.end(), nonce.begin());
+    nonce[14] = static_cast<uint8_t>(i);
+    nonce[15] = (i == 2) ? 0x01 : 0x00;
+
+    const size_t pt_byte_len = (i == 2) ? 5 : SEGMENT_BYTE_LEN;
+    std::vector<uint8_t> expected(pt_byte_len + ascon_aead128::TAG_BYTE_LEN);
+
+    EXPECT_EQ(ascon_aead128::seal(key, nonce, {}, std::span(plaintext).subspan(i * SEGMENT_BYTE_LEN, pt_byte_len), expected),
+              ascon_aead128::ascon_aead128_status_t::sealed);
+    EXPECT_TRUE(std::ranges::equal(stream_span.subspan(i * (SEGMENT_BYTE_LEN + ascon_aead128::TAG_BYTE_LEN), expected.size()), expected));
+  }
+}
+
+TEST(AsconAEAD128Stream, RandomAccessDecryptionOfEachSegment)
+{
+  std::array<uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::array<uint8_t, 7> associated_data{};
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(associated_data);
+
+  for (const size_t pt_byte_len : PLAINTEXT_LENS) {
+    std::vector<uint8_t> plaintext(pt_byte_len);
+    generate_random_data<uint8_t>(plaintext);
+
+    const auto stream = encrypt_one_segment_at_a_time(key, nonce_prefix, associated_data, plaintext);
+    const size_t num_segments = ascon_aead128_stream::segment_count(pt_byte_len, SEGMENT_BYTE_LEN);
+
+    // Segments are decrypted in reverse order, to show that they don't depend on each other
+    for (size_t i = num_segments; i > 0; i--) {
+      const size_t segment_idx = i - 1;
+      const size_t offset = segment_idx * SEGMENT_BYTE_LEN;
+
+      std::vector<uint8_t> decrypted(std::min(SEGMENT_BYTE_LEN, pt_byte_len - offset));
+
+      EXPECT_EQ(ascon_aead128_stream::decrypt_segment_at(key, nonce_prefix, associated_data, stream, segment_idx, decrypted, SEGMENT_BYTE_LEN),
+                ascon_aead128_stream::ascon_aead128_stream_status_t::decrypted_segment);
+      EXPECT_TRUE(std::ranges::equal(decrypted, std::span(plaintext).subspan(offset, decrypted.size())));
+    }
+
+    std::vector<uint8_t> decrypted(SEGMENT_BYTE_LEN);
+    EXPECT_EQ(ascon_aead128_stream::decrypt_segment_at(key, nonce_prefix, associated_data, stream, num_segments, decrypted, SEGMENT_BYTE_LEN),
+              ascon_aead128_stream::ascon_aead128_stream_status_t::segment_index_out_of_range);
+  }
+}
+
+TEST(AsconAEAD128Stream, TamperedTruncatedOrReorderedStreamFailsDecryption)
+{
+  std::array<uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::vector<uint8_t> plaintext(4 * SEGMENT_BYTE_LEN);
+
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce_prefix);
+  generate_random_data<uint8_t>(plaintext);
+
+  const auto stream = encrypt_one_segment_at_a_time(key, nonce_prefix, {}, plaintext);
+  constexpr size_t ENCRYPTED_SEGMENT_BYTE_LEN = SEGMENT_BYTE_LEN + ascon_aead128_stream::TAG_BYTE_LEN;
+
+  const auto expect_decryption_failure = [&](std::span<const uint8_t> modified_stream) {
+    std::vector<uint8_t> decrypted(ascon_aead128_stream::plaintext_byte_len(modified_stream.size(), SEGMENT_BYTE_LEN));
+    std::fill(decrypted.begin(), decrypted.end(), 0xff);
+
+    EXPECT_EQ(ascon_aead128_stream::decrypt(ascon_parallel::default_thread_pool(), key, nonce_prefix, {}, modified_stream, decrypted, SEGMENT_BYTE_LEN),
+              ascon_aead128_stream::ascon_aead128_stream_status_t::decryption_failure_due_to_tag_mismatch);
+    EXPECT_TRUE(std::ranges::all_of(decrypted, [](const auto b) { return b == 0x00; }));
+  };
+
+  // Bit flipped in ciphertext of some segment
+  auto tampered = stream;
+  do_bitflip(std::span(tampered).subspan(2 * ENCRYPTED_SEGMENT_BYTE_LEN, SEGMENT_BYTE_LEN));
+  expect_decryption_failure(tampered);
+
+  // Last segment dropped - stream still consists of whole segments, but the one now at the end is not flagged as last
+  const auto truncated = std::span(stream).first(3 * ENCRYPTED_SEGMENT_BYTE_LEN);
+  expect_decryption_failure(truncated);
+
+  // Two segments swapped
+  auto reordered = stream;
+  std::swap_ranges(reordered.begin(),
+                   reordered.begin() + ENCRYPTED_SEGMENT_BYTE_LEN,
+                   reordered.begin() + ENCRYPTED_SEGMENT_BYTE_LEN);
+  expect_decryption_failure(reordered);
+
+  // Online decryptor refuses to release the tampered segment, and accepts neither truncated stream's end as the last segment
+  std::vector<uint8_t> decrypted(SEGMENT_BYTE_LEN);
+  ascon_aead128_stream::ascon_aead128_stream_decryptor_t decryptor(key, nonce_prefix, SEGMENT_BYTE_LEN);
+
+  for (size_t i = 0; i < 2; i++) {
+    EXPECT_EQ(decryptor.decrypt_segment({}, std::span(tampered).subspan(i * ENCRYPTED_SEGMENT_BYTE_LEN, ENCRYPTED_SEGMENT_BYTE_LEN), decrypted, false),
+              ascon_aead128_stream::ascon_aead128_stream_status_t::decrypted_segment);
+  }
+  EXPECT_EQ(decryptor.decrypt_segment({}, std::span(tampered).subspan(2 * ENCRYPTED_SEGMENT_BYTE_LEN, ENCRYPTED_SEGMENT_BYTE_LEN), decrypted, false),
+            ascon_aead128_stream::ascon_aead128_stream_status_t::decryption_failure_due_to_tag_mismatch);
+  EXPECT_TRUE(std::ranges::all_of(decrypted, [](const auto b) { return b == 0x00; }));
+
+  EXPECT_EQ(decryptor.decrypt_segment({}, std::span(stream).subspan(2 * ENCRYPTED_SEGMENT_BYTE_LEN, ENCRYPTED_SEGMENT_BYTE_LEN), decrypted, true),
+            ascon_aead128_stream::ascon_aead128_stream_status_t::decryption_failure_due_to_tag_mismatch);
+  EXPECT_FALSE(decryptor.is_finalized());
+}
+
+TEST(AsconAEAD128Stream, InvalidUsage)
+{
+  std::array<uint8_t, ascon_aead128_stream::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128_stream::NONCE_PREFIX_BYTE_LEN> nonce_prefix{};
+  std::array<uint8_t, SEGMENT_BYTE_LEN + 1> plaintext{};
+  std::array<uint8_t, SEGMENT_BYTE_LEN + 1 + ascon_aead128_stream::TAG_BYTE_LEN> ciphertext_and_tag{};
+
+  ascon_aead128_stream::ascon_aead128_stream_encryptor_t encryptor(key, nonce_prefix, SEGMENT_BYTE_LEN);
+
+  // Non-last segment must be exactly a segment long, last one can't be longer
+  EXPECT_EQ(encryptor.encrypt_segment({}, std::span(plaintext).first(SEGMENT_BYTE_LEN - 1), ciphertext_and_tag, false),
+            ascon_aead128_stream::ascon_aead128_stream_status_t::buffer_length_mismatch);
+  EXPECT_EQ(encryptor.encrypt_segment({}, plaintext, ciphertext_and_tag, true), ascon_aead128_stream::ascon_aead128_stream_status_t::buffer_length_mismatch);
+  EXPECT_EQ(encryptor.encrypt_segment({}, std::span(plaintext).first(8), ciphertext_and_tag, true),
+            ascon_aead128_stream::ascon_aead128_stream_status_t::buffer_length_mismatch);
+
+  EXPECT_EQ(encryptor.encrypt_segment({}, std::span(plaintext).first(8), std::span(ciphertext_and_tag).first(8 + ascon_aead128_stream::TAG_BYTE_LEN), true),
+            ascon_aead128_stream::ascon_aead128_stream_status_t::encrypted_segment);
+  EXPECT_EQ(encryptor.encrypt_segment({}, std::span(plaintext).first(8), std::span(ciphertext_and_tag).first(8 + ascon_aead128_stream::TAG_BYTE_LEN), true),
+            ascon_aead128_stream::ascon_aead128_stream_status_t::stream_already_finalized);
+
+  // Encrypted stream can't be shorter than a tag, or end with a partial tag
+  std::vector<uint8_t> decrypted(SEGMENT_BYTE_LEN);
+  EXPECT_EQ(ascon_aead128_stream::decrypt(ascon_parallel::default_thread_pool(),
+                                          key,
+                                          nonce_prefix,
+                                          {},
+                                          std::span(ciphertext_and_tag).first(ascon_aead128_stream::TAG_BYTE_LEN - 1),
+                                          std::span(decrypted).first(0),
+                                          SEGMENT_BYTE_LEN),
+            ascon_aead128_stream::ascon_aead128_stream_status_t::buffer_length_mismatch);
+  EXPECT_EQ(ascon_aead128_stream::decrypt(ascon_parallel::default_thread_pool(),
+                                          key,
+                                          nonce_prefix,
+                                          {},
+                                          std::span(ciphertext_and_tag).first(SEGMENT_BYTE_LEN + ascon_aead128_stream::TAG_BYTE_LEN + 1),
+                                          decrypted,
+                                          SEGMENT_BYTE_LEN),
+            ascon_aead128_stream::ascon_aead128_stream_status_t::buffer_length_mismatch);
+
+  // Zero length segments are not allowed
+  std::vector<uint8_t> stream(ascon_aead128_stream::TAG_BYTE_LEN);
+  EXPECT_EQ(ascon_aead128_stream::encrypt(ascon_parallel::default_thread_pool(), key, nonce_prefix, {}, {}, stream, 0),
+            ascon_aead128_stream::ascon_aead128_stream_status_t::buffer_length_mismatch);
+}
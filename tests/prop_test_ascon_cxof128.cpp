@@ -109,6 +109,83 @@ TEST(AsconCXOF128, ForSameMessageOneshotHashingAndIncrementalHashingProducesSame
   }
 }
 
+TEST(AsconCXOF128, StartingFromPrefixStateProducesSameOutputAsCustomizing)
+{
+  constexpr size_t OUTPUT_BYTE_LEN = 32;
+
+  for (size_t cust_str_byte_len = MIN_CUST_STR_LEN; cust_str_byte_len <= ascon_cxof128::CUSTOMIZATION_STRING_MAX_BYTE_LEN; cust_str_byte_len++) {
+    std::vector<uint8_t> cust_str(cust_str_byte_len);
+    std::array<uint8_t, 32> msg{};
+
+    generate_random_data<uint8_t>(cust_str);
+
+    ascon_cxof128::ascon_cxof128_prefix_t prefix;
+    EXPECT_EQ(prefix.customize(cust_str), ascon_cxof128::ascon_cxof128_status_t::customized);
+    EXPECT_EQ(prefix.customize(cust_str), ascon_cxof128::ascon_cxof128_status_t::already_customized);
+
+    // Same prefix state is reused for many messages.
+    for (size_t i = 0; i < 4; i++) {
+      generate_random_data<uint8_t>(msg);
+
+      std::array<uint8_t, OUTPUT_BYTE_LEN> expected{};
+      std::array<uint8_t, OUTPUT_BYTE_LEN> from_prefix{};
+      std::array<uint8_t, OUTPUT_BYTE_LEN> from_copy{};
+
+      ascon_cxof128::ascon_cxof128_t hasher;
+      EXPECT_EQ(hasher.customize(cust_str), ascon_cxof128::ascon_cxof128_status_t::customized);
+
+      // Copy of a customized instance is customized too.
+      ascon_cxof128::ascon_cxof128_t hasher_copy = hasher;
+
+      EXPECT_EQ(hasher.absorb(msg), ascon_cxof128::ascon_cxof128_status_t::absorbed_data);
+      EXPECT_EQ(hasher.finalize(), ascon_cxof128::ascon_cxof128_status_t::finalized_data_absorption_phase);
+      EXPECT_EQ(hasher.squeeze(expected), ascon_cxof128::ascon_cxof128_status_t::squeezed_output);
+
+      ascon_cxof128::ascon_cxof128_t prefixed_hasher(prefix);
+      EXPECT_EQ(prefixed_hasher.customize(cust_str), ascon_cxof128::ascon_cxof128_status_t::already_customized);
+      EXPECT_EQ(prefixed_hasher.absorb(msg), ascon_cxof128::ascon_cxof128_status_t::absorbed_data);
+      EXPECT_EQ(prefixed_hasher.finalize(), ascon_cxof128::ascon_cxof128_status_t::finalized_data_absorption_phase);
+      EXPECT_EQ(prefixed_hasher.squeeze(from_prefix), ascon_cxof128::ascon_cxof128_status_t::squeezed_output);
+
+      EXPECT_EQ(hasher_copy.absorb(msg), ascon_cxof128::ascon_cxof128_status_t::absorbed_data);
+      EXPECT_EQ(hasher_copy.finalize(), ascon_cxof128::ascon_cxof128_status_t::finalized_data_absorption_phase);
+      EXPECT_EQ(hasher_copy.squeeze(from_copy), ascon_cxof128::ascon_cxof128_status_t::squeezed_output);
+
+      EXPECT_EQ(from_prefix, expected);
+      EXPECT_EQ(from_copy, expected);
+    }
+  }
+}
+
+TEST(AsconCXOF128, CompileTimePrefixStateMatchesRunTimePrefixState)
+{
+  constexpr auto compile_time_prefix = ascon_cxof128::compute_prefix("ASCON");
+  static_assert(compile_time_prefix.is_customized(), "Must be able to customize Ascon-CXOF128 prefix state during program compilation time itself !");
+
+  constexpr std::array<uint8_t, 5> cust_str = { 'A', 'S', 'C', 'O', 'N' };
+
+  ascon_cxof128::ascon_cxof128_prefix_t run_time_prefix;
+  EXPECT_EQ(run_time_prefix.customize(cust_str), ascon_cxof128::ascon_cxof128_status_t::customized);
+
+  EXPECT_EQ(compile_time_prefix.permutation_state().reveal(), run_time_prefix.permutation_state().reveal());
+}
+
+TEST(AsconCXOF128, StartingFromUncustomizedPrefixState)
+{
+  std::vector<uint8_t> cust_str(ascon_cxof128::CUSTOMIZATION_STRING_MAX_BYTE_LEN + 1);
+
+  ascon_cxof128::ascon_cxof128_prefix_t prefix;
+  EXPECT_EQ(prefix.customize(cust_str), ascon_cxof128::ascon_cxof128_status_t::failed_to_customize_with_too_long_string);
+  EXPECT_FALSE(prefix.is_customized());
+
+  std::array<uint8_t, 8> msg{};
+
+  ascon_cxof128::ascon_cxof128_t hasher(prefix);
+  EXPECT_EQ(hasher.absorb(msg), ascon_cxof128::ascon_cxof128_status_t::not_yet_customized);
+  EXPECT_EQ(hasher.customize(std::span(cust_str).first(8)), ascon_cxof128::ascon_cxof128_status_t::customized);
+  EXPECT_EQ(hasher.absorb(msg), ascon_cxof128::ascon_cxof128_status_t::absorbed_data);
+}
+
 TEST(AsconCXOF128, ValidCXOFSequence)
 {
   std::array<uint8_t, 8> cstr{};
@@ -0,0 +1,124 @@
+#include "ascon/hashes/ascon_hash256.hpp"
+#include "ascon/utils/file.hpp"
+#include "test_helper.hpp"
+#include <array>
+#include <cstdlib>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <unistd.h>
+
+static std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN>
+hash_in_memory(std::span<const uint8_t> msg)
+{
+  std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+  ascon_hash256::ascon_hash256_t hasher;
+  EXPECT_EQ(hasher.absorb(msg), ascon_hash256::ascon_hash256_status_t::absorbed_data);
+  EXPECT_EQ(hasher.finalize(), ascon_hash256::ascon_hash256_status_t::finalized_data_absorption_phase);
+  EXPECT_EQ(hasher.digest(digest), ascon_hash256::ascon_hash256_status_t::message_digest_produced);
+
+  return digest;
+}
+
+TEST(AsconFile, HashingFileMatchesHashingInMemory)
+{
+  constexpr std::array<size_t, 7> FILE_LENS = { 0, 1, 7, 8, 4'097, ascon_file::READ_BUFFER_BYTE_LEN, 3 * ascon_file::READ_BUFFER_BYTE_LEN + 13 };
+
+  for (const size_t file_len : FILE_LENS) {
+    std::vector<uint8_t> content(file_len);
+    generate_random_data<uint8_t>(content);
+
+    const auto path = write_temp_file(content);
+    const auto expected = hash_in_memory(content);
+
+    for (const auto method :
+         { ascon_file::ascon_file_read_method_t::automatic, ascon_file::ascon_file_read_method_t::mmap, ascon_file::ascon_file_read_method_t::buffered_read }) {
+      std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+      EXPECT_EQ(ascon_file::hash_file(path.c_str(), digest, method), ascon_file::ascon_file_status_t::processed_file);
+      EXPECT_EQ(digest, expected);
+    }
+
+    ::unlink(path.c_str());
+  }
+}
+
+TEST(AsconFile, HashingPipeFallsBackToBufferedRead)
+{
+  std::vector<uint8_t> content(2 * ascon_file::READ_BUFFER_BYTE_LEN + 5);
+  generate_random_data<uint8_t>(content);
+
+  const auto expected = hash_in_memory(content);
+
+  for (const auto method : { ascon_file::ascon_file_read_method_t::automatic, ascon_file::ascon_file_read_method_t::mmap }) {
+    std::array<int, 2> fds{};
+    EXPECT_EQ(::pipe(fds.data()), 0);
+
+    std::thread writer([&]() {
+      size_t off = 0;
+      while (off < content.size()) {
+        const ssize_t n = ::write(fds[1], content.data() + off, content.size() - off);
+        if (n <= 0) {
+          break;
+        }
+        off += static_cast<size_t>(n);
+      }
+      ::close(fds[1]);
+    });
+
+    std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+    const auto status = ascon_file::hash_fd(fds[0], digest, method);
+
+    if (method == ascon_file::ascon_file_read_method_t::mmap) {
+      EXPECT_EQ(status, ascon_file::ascon_file_status_t::failed_to_map_file);
+
+      // Drain the pipe, so that writer can finish.
+      std::array<uint8_t, 4'096> sink{};
+      while (::read(fds[0], sink.data(), sink.size()) > 0) {
+      }
+    } else {
+      EXPECT_EQ(status, ascon_file::ascon_file_status_t::processed_file);
+      EXPECT_EQ(digest, expected);
+    }
+
+    writer.join();
+    ::close(fds[0]);
+  }
+}
+
+TEST(AsconFile, HashingFdStartsFromCurrentOffset)
+{
+  std::vector<uint8_t> content(3 * 4'096 + 29);
+  generate_random_data<uint8_t>(content);
+
+  const auto path = write_temp_file(content);
+
+  // Offsets at the beginning, within first page, past first page (not page aligned), on a page boundary, at the end.
+  for (const size_t offset : { size_t{ 0 }, size_t{ 5 }, size_t{ 4'097 }, size_t{ 2 * 4'096 }, content.size() }) {
+    const auto expected = hash_in_memory(std::span(content).subspan(offset));
+
+    for (const auto method :
+         { ascon_file::ascon_file_read_method_t::automatic, ascon_file::ascon_file_read_method_t::mmap, ascon_file::ascon_file_read_method_t::buffered_read }) {
+      const int fd = ::open(path.c_str(), O_RDONLY);
+      EXPECT_GE(fd, 0);
+      EXPECT_EQ(::lseek(fd, static_cast<off_t>(offset), SEEK_SET), static_cast<off_t>(offset));
+
+      std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+      EXPECT_EQ(ascon_file::hash_fd(fd, digest, method), ascon_file::ascon_file_status_t::processed_file);
+      EXPECT_EQ(digest, expected);
+
+      // Whichever way the file was accessed, descriptor is left at its end.
+      EXPECT_EQ(::lseek(fd, 0, SEEK_CUR), static_cast<off_t>(content.size()));
+      ::close(fd);
+    }
+  }
+
+  ::unlink(path.c_str());
+}
+
+TEST(AsconFile, HashingNonExistentFile)
+{
+  std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+  EXPECT_EQ(ascon_file::hash_file("/this/path/does/not/exist", digest), ascon_file::ascon_file_status_t::failed_to_open_file);
+}
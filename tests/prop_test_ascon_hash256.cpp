@@ -191,3 +191,142 @@ TEST(AsconHash256, DigestWithoutFinalize)
   EXPECT_EQ(hasher.absorb(msg), ascon_hash256::ascon_hash256_status_t::absorbed_data);
   EXPECT_EQ(hasher.digest(digest), ascon_hash256::ascon_hash256_status_t::still_in_data_absorption_phase);
 }
+
+// Computes Ascon-Hash256 digest of given message, in two pieces, by driving sponge mode directly with given permutation state representation.
+template<ascon_perm::ascon_perm_state perm_t>
+static std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN>
+hash_with_state_representation(std::span<const uint8_t> msg)
+{
+  perm_t state(ascon_hash256::INITIAL_PERMUTATION_STATE.reveal());
+  size_t offset = 0;
+  size_t readable = ascon_sponge_mode::RATE_BYTES;
+
+  ascon_sponge_mode::absorb(state, offset, msg.first(msg.size() / 2));
+  ascon_sponge_mode::absorb(state, offset, msg.subspan(msg.size() / 2));
+  ascon_sponge_mode::finalize(state, offset);
+
+  std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+  ascon_sponge_mode::squeeze(state, readable, digest);
+
+  return digest;
+}
+
+TEST(AsconHash256, SpongeModeWorksWithAnyStateRepresentation)
+{
+  for (size_t msg_len = MIN_MSG_LEN; msg_len <= MAX_MSG_LEN; msg_len++) {
+    std::vector<uint8_t> msg(msg_len);
+    std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+    generate_random_data<uint8_t>(msg);
+
+    ascon_hash256::ascon_hash256_t hasher;
+    EXPECT_EQ(hasher.absorb(msg), ascon_hash256::ascon_hash256_status_t::absorbed_data);
+    EXPECT_EQ(hasher.finalize(), ascon_hash256::ascon_hash256_status_t::finalized_data_absorption_phase);
+    EXPECT_EQ(hasher.digest(digest), ascon_hash256::ascon_hash256_status_t::message_digest_produced);
+
+    EXPECT_EQ(hash_with_state_representation<ascon_perm::ascon_perm_u64_t>(msg), digest);
+    EXPECT_EQ(hash_with_state_representation<ascon_perm::ascon_perm_bi32_t>(msg), digest);
+  }
+}
+
+// Hashes a batch of random messages of ragged lengths, both using `hash_many` and `ascon_hash256_t`, checking that all digests match.
+template<const size_t LANES>
+static void
+test_batched_hashing_produces_same_digests(const size_t num_msgs)
+{
+  std::vector<std::vector<uint8_t>> msgs(num_msgs);
+  std::vector<std::span<const uint8_t>> msg_spans(num_msgs);
+
+  for (size_t i = 0; i < num_msgs; i++) {
+    std::array<uint16_t, 1> msg_byte_len{};
+    generate_random_data<uint16_t>(msg_byte_len);
+
+    msgs[i].resize(msg_byte_len[0] % (MAX_MSG_LEN + 1));
+    generate_random_data<uint8_t>(msgs[i]);
+
+    msg_spans[i] = msgs[i];
+  }
+
+  std::vector<std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN>> digests_batched(num_msgs);
+  EXPECT_EQ(ascon_hash256::hash_many<LANES>(msg_spans, digests_batched), ascon_hash256::ascon_hash256_status_t::batch_message_digests_produced);
+
+  for (size_t i = 0; i < num_msgs; i++) {
+    std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+    ascon_hash256::ascon_hash256_t hasher;
+    EXPECT_EQ(hasher.absorb(msgs[i]), ascon_hash256::ascon_hash256_status_t::absorbed_data);
+    EXPECT_EQ(hasher.finalize(), ascon_hash256::ascon_hash256_status_t::finalized_data_absorption_phase);
+    EXPECT_EQ(hasher.digest(digest), ascon_hash256::ascon_hash256_status_t::message_digest_produced);
+
+    EXPECT_EQ(digests_batched[i], digest);
+  }
+}
+
+TEST(AsconHash256, ForSameMessagesBatchedHashingAndOneByOneHashingProducesSameDigests)
+{
+  for (size_t num_msgs = 0; num_msgs <= 33; num_msgs++) {
+    test_batched_hashing_produces_same_digests<1>(num_msgs);
+    test_batched_hashing_produces_same_digests<2>(num_msgs);
+    test_batched_hashing_produces_same_digests<4>(num_msgs);
+    test_batched_hashing_produces_same_digests<8>(num_msgs);
+    test_batched_hashing_produces_same_digests<ascon_perm::NATIVE_LANE_COUNT>(num_msgs);
+  }
+}
+
+TEST(AsconHash256, BatchedHashingWithMismatchingBatchSize)
+{
+  std::array<uint8_t, 16> msg{};
+  std::array<std::span<const uint8_t>, 2> msgs{ msg, msg };
+  std::array<std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN>, 1> digests{};
+
+  EXPECT_EQ(ascon_hash256::hash_many(msgs, digests), ascon_hash256::ascon_hash256_status_t::batch_size_mismatch);
+}
+
+// Hashes a random message of MSG_BYTE_LEN -bytes, both using compile-time specialized and incremental hashing API, checking that digests match.
+template<const size_t MSG_BYTE_LEN>
+static void
+test_fixed_length_hashing_matches_incremental_hashing()
+{
+  std::array<uint8_t, MSG_BYTE_LEN> msg{};
+  std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest_fixed{};
+  std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest_incremental{};
+
+  generate_random_data<uint8_t>(msg);
+
+  ascon_hash256::hash(std::span<const uint8_t, MSG_BYTE_LEN>(msg), std::span(digest_fixed));
+
+  ascon_hash256::ascon_hash256_t hasher;
+  EXPECT_EQ(hasher.absorb(msg), ascon_hash256::ascon_hash256_status_t::absorbed_data);
+  EXPECT_EQ(hasher.finalize(), ascon_hash256::ascon_hash256_status_t::finalized_data_absorption_phase);
+  EXPECT_EQ(hasher.digest(digest_incremental), ascon_hash256::ascon_hash256_status_t::message_digest_produced);
+
+  EXPECT_EQ(digest_fixed, digest_incremental);
+}
+
+TEST(AsconHash256, ForSameMessageFixedLengthHashingAndIncrementalHashingProducesSameDigest)
+{
+  [&]<size_t... I>(std::index_sequence<I...>) {
+    (test_fixed_length_hashing_matches_incremental_hashing<I>(), ...);
+  }(std::make_index_sequence<ascon_sponge_mode::RATE_BYTES * 3 + 1>{});
+
+  test_fixed_length_hashing_matches_incremental_hashing<64>();
+  test_fixed_length_hashing_matches_incremental_hashing<128>();
+}
+
+TEST(AsconHash256, CompileTimeComputeFixedLengthMessageDigest)
+{
+  // AsconHash256("000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F") = "BD9D3D60A66B53868EAB2A5C74539A518A1F60F01EB176C60E43DEE81680B33E"
+  constexpr auto md = []() {
+    std::array<uint8_t, 32> data{};
+    std::iota(data.begin(), data.end(), 0);
+
+    std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> md{};
+    ascon_hash256::hash(std::span<const uint8_t, data.size()>(data), std::span(md));
+
+    return bytes_to_hex(md);
+  }();
+  constexpr auto is_matching = md == eval_ascon_hash256();
+
+  static_assert(is_matching, "Must be able to evaluate fixed-length Ascon-Hash256 during program compilation time itself !");
+  EXPECT_TRUE(is_matching);
+}
@@ -0,0 +1,295 @@
+#include "ascon/aead/ascon_aead128.hpp"
+#include "ascon/hashes/ascon_hash256.hpp"
+#include "ascon/utils/instrumentation.hpp"
+#include "test_helper.hpp"
+#include <array>
+#include <gtest/gtest.h>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Instrumentation is enabled or disabled for the whole program, so these tests check exact counts only when all translation units are built with
+// `ASCON_ENABLE_INSTRUMENTATION` i.e. `CXX_DEFS=-DASCON_ENABLE_INSTRUMENTATION make test`, otherwise they check that nothing is counted.
+
+using ascon_instrumentation::phase_t;
+
+static constexpr size_t HASH_RATE_BYTES = ascon_sponge_mode::RATE_BYTES;
+static constexpr size_t AEAD_RATE_BYTES = ascon_duplex_mode::RATE_BYTES;
+
+#if defined(ASCON_ENABLE_INSTRUMENTATION)
+
+TEST(AsconInstrumentation, CountsPermutationsAndBlocksOfHashing)
+{
+  for (size_t msg_byte_len = MIN_MSG_LEN; msg_byte_len <= MAX_MSG_LEN; msg_byte_len++) {
+    std::vector<uint8_t> msg(msg_byte_len);
+    std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+    generate_random_data<uint8_t>(msg);
+    ascon_instrumentation::reset();
+
+    ascon_hash256::ascon_hash256_t hasher;
+    EXPECT_EQ(hasher.absorb(msg), ascon_hash256::ascon_hash256_status_t::absorbed_data);
+    EXPECT_EQ(hasher.finalize(), ascon_hash256::ascon_hash256_status_t::finalized_data_absorption_phase);
+    EXPECT_EQ(hasher.digest(digest), ascon_hash256::ascon_hash256_status_t::message_digest_produced);
+
+    const auto snapshot = ascon_instrumentation::snapshot();
+
+    // Initial state is computed during program compilation, so the only permutations are the ones absorbing full blocks, finalizing and squeezing.
+    const size_t num_squeezed_blocks = ascon_hash256::DIGEST_BYTE_LEN / HASH_RATE_BYTES;
+    EXPECT_EQ(snapshot.permutations[ascon_sponge_mode::ASCON_PERM_NUM_ROUNDS], (msg_byte_len / HASH_RATE_BYTES) + 1 + num_squeezed_blocks);
+    EXPECT_EQ(snapshot.total_permutations(), snapshot.permutations[ascon_sponge_mode::ASCON_PERM_NUM_ROUNDS]);
+
+    EXPECT_EQ(snapshot[phase_t::hash_absorb].full_blocks, msg_byte_len / HASH_RATE_BYTES);
+    EXPECT_EQ(snapshot[phase_t::hash_absorb].partial_blocks, (msg_byte_len % HASH_RATE_BYTES) > 0);
+    EXPECT_EQ(snapshot[phase_t::hash_absorb].bytes, msg_byte_len);
+
+    EXPECT_EQ(snapshot[phase_t::hash_squeeze].full_blocks, num_squeezed_blocks);
+    EXPECT_EQ(snapshot[phase_t::hash_squeeze].partial_blocks, 0u);
+    EXPECT_EQ(snapshot[phase_t::hash_squeeze].bytes, ascon_hash256::DIGEST_BYTE_LEN);
+  }
+}
+
+TEST(AsconInstrumentation, CountsPermutationsAndBlocksOfAEAD)
+{
+  for (size_t ad_byte_len = MIN_AD_LEN; ad_byte_len <= MAX_AD_LEN; ad_byte_len++) {
+    for (size_t pt_byte_len = MIN_PT_LEN; pt_byte_len <= MAX_PT_LEN; pt_byte_len++) {
+      std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+      std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+      std::vector<uint8_t> associated_data(ad_byte_len);
+      std::vector<uint8_t> plaintext(pt_byte_len);
+      std::vector<uint8_t> ciphertext_and_tag(pt_byte_len + ascon_aead128::TAG_BYTE_LEN);
+      std::vector<uint8_t> decrypted(pt_byte_len);
+
+      generate_random_data<uint8_t>(key);
+      generate_random_data<uint8_t>(nonce);
+      generate_random_data<uint8_t>(associated_data);
+      generate_random_data<uint8_t>(plaintext);
+
+      const ascon_aead128::ascon_aead128_key_t key_ctx(key);
+
+      ascon_instrumentation::reset();
+      EXPECT_EQ(ascon_aead128::seal(key_ctx, nonce, associated_data, plaintext, ciphertext_and_tag), ascon_aead128::ascon_aead128_status_t::sealed);
+      EXPECT_EQ(ascon_aead128::open(key_ctx, nonce, associated_data, ciphertext_and_tag, decrypted),
+                ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+
+      const auto snapshot = ascon_instrumentation::snapshot();
+
+      // Each of seal and open runs initialization and finalization permutations, along with one for each full block and one for padded associated data.
+      const size_t num_perm_b = (ad_byte_len / AEAD_RATE_BYTES) + (ad_byte_len > 0) + (pt_byte_len / AEAD_RATE_BYTES);
+      EXPECT_EQ(snapshot.permutations[ascon_duplex_mode::ASCON_PERM_NUM_ROUNDS_A], 2u * 2u);
+      EXPECT_EQ(snapshot.permutations[ascon_duplex_mode::ASCON_PERM_NUM_ROUNDS_B], 2u * num_perm_b);
+      EXPECT_EQ(snapshot.total_rounds(), 2u * (2u * ascon_duplex_mode::ASCON_PERM_NUM_ROUNDS_A + num_perm_b * ascon_duplex_mode::ASCON_PERM_NUM_ROUNDS_B));
+
+      EXPECT_EQ(snapshot[phase_t::aead_associated_data].full_blocks, 2u * (ad_byte_len / AEAD_RATE_BYTES));
+      EXPECT_EQ(snapshot[phase_t::aead_associated_data].partial_blocks, 2u * ((ad_byte_len % AEAD_RATE_BYTES) > 0));
+      EXPECT_EQ(snapshot[phase_t::aead_associated_data].bytes, 2u * ad_byte_len);
+
+      for (const auto phase : { phase_t::aead_encrypt, phase_t::aead_decrypt }) {
+        EXPECT_EQ(snapshot[phase].full_blocks, pt_byte_len / AEAD_RATE_BYTES);
+        EXPECT_EQ(snapshot[phase].partial_blocks, (pt_byte_len % AEAD_RATE_BYTES) > 0);
+        EXPECT_EQ(snapshot[phase].bytes, pt_byte_len);
+      }
+
+      EXPECT_EQ(snapshot[phase_t::hash_absorb].bytes, 0u);
+      EXPECT_EQ(snapshot[phase_t::hash_squeeze].bytes, 0u);
+    }
+  }
+}
+
+TEST(AsconInstrumentation, CountsOnlyActiveLanesOfBatchHashing)
+{
+  constexpr size_t LANES = 4;
+
+  // More messages than lanes, of ragged lengths, so that lanes go idle at different times, while the last ones are left without a message.
+  const std::array<size_t, 7> msg_byte_lens = { 0, 1, 8, 17, 64, 3, 100 };
+
+  std::vector<std::vector<uint8_t>> msgs;
+  std::vector<std::span<const uint8_t>> msg_spans;
+  for (const size_t msg_byte_len : msg_byte_lens) {
+    generate_random_data<uint8_t>(msgs.emplace_back(msg_byte_len));
+  }
+  for (const auto& msg : msgs) {
+    msg_spans.emplace_back(msg);
+  }
+
+  std::vector<std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN>> digests(msgs.size());
+
+  ascon_instrumentation::reset();
+  EXPECT_EQ(ascon_hash256::hash_many<LANES>(msg_spans, digests), ascon_hash256::ascon_hash256_status_t::batch_message_digests_produced);
+
+  const auto snapshot = ascon_instrumentation::snapshot();
+
+  // Each message takes a permutation per full block, one for the padded last block and one per squeezed block, except the last one.
+  constexpr size_t NUM_SQUEEZED_BLOCKS = ascon_hash256::DIGEST_BYTE_LEN / HASH_RATE_BYTES;
+
+  size_t expected_num_perms = 0;
+  size_t expected_full_blocks = 0;
+  size_t expected_partial_blocks = 0;
+  size_t expected_bytes = 0;
+
+  for (const size_t msg_byte_len : msg_byte_lens) {
+    expected_num_perms += (msg_byte_len / HASH_RATE_BYTES) + 1 + (NUM_SQUEEZED_BLOCKS - 1);
+    expected_full_blocks += msg_byte_len / HASH_RATE_BYTES;
+    expected_partial_blocks += (msg_byte_len % HASH_RATE_BYTES) > 0;
+    expected_bytes += msg_byte_len;
+  }
+
+  EXPECT_EQ(snapshot.permutations[ascon_sponge_mode::ASCON_PERM_NUM_ROUNDS], expected_num_perms);
+  EXPECT_EQ(snapshot.total_permutations(), expected_num_perms);
+
+  EXPECT_EQ(snapshot[phase_t::hash_absorb].full_blocks, expected_full_blocks);
+  EXPECT_EQ(snapshot[phase_t::hash_absorb].partial_blocks, expected_partial_blocks);
+  EXPECT_EQ(snapshot[phase_t::hash_absorb].bytes, expected_bytes);
+
+  EXPECT_EQ(snapshot[phase_t::hash_squeeze].full_blocks, msgs.size() * NUM_SQUEEZED_BLOCKS);
+  EXPECT_EQ(snapshot[phase_t::hash_squeeze].partial_blocks, 0u);
+  EXPECT_EQ(snapshot[phase_t::hash_squeeze].bytes, msgs.size() * ascon_hash256::DIGEST_BYTE_LEN);
+}
+
+TEST(AsconInstrumentation, BurstCountsSameAsOnePacketAtATime)
+{
+  constexpr size_t LANES = 4;
+
+  // More packets than lanes, so that the second group leaves most lanes idle, with ragged associated data and plaintext lengths, so that lanes are masked off
+  // at different steps.
+  const std::array<std::pair<size_t, size_t>, 6> ad_and_pt_byte_lens = { { { 0, 0 }, { 1, 15 }, { 16, 16 }, { 40, 3 }, { 7, 100 }, { 0, 33 } } };
+
+  std::array<uint8_t, ascon_aead128::KEY_BYTE_LEN> key{};
+  std::array<uint8_t, ascon_aead128::NONCE_BYTE_LEN> nonce{};
+  generate_random_data<uint8_t>(key);
+  generate_random_data<uint8_t>(nonce);
+
+  std::vector<std::vector<uint8_t>> associated_data;
+  std::vector<std::vector<uint8_t>> plaintexts;
+  std::vector<std::vector<uint8_t>> ciphertexts;
+  std::vector<std::vector<uint8_t>> decrypteds;
+  std::vector<std::array<uint8_t, ascon_aead128::TAG_BYTE_LEN>> tags(ad_and_pt_byte_lens.size());
+
+  for (const auto& [ad_byte_len, pt_byte_len] : ad_and_pt_byte_lens) {
+    generate_random_data<uint8_t>(associated_data.emplace_back(ad_byte_len));
+    generate_random_data<uint8_t>(plaintexts.emplace_back(pt_byte_len));
+    ciphertexts.emplace_back(pt_byte_len);
+    decrypteds.emplace_back(pt_byte_len);
+  }
+
+  std::vector<ascon_aead128::ascon_aead128_encrypt_packet_t> encrypt_packets;
+  std::vector<ascon_aead128::ascon_aead128_decrypt_packet_t> decrypt_packets;
+  std::vector<ascon_aead128::ascon_aead128_status_t> results(ad_and_pt_byte_lens.size());
+
+  for (size_t i = 0; i < ad_and_pt_byte_lens.size(); i++) {
+    encrypt_packets.push_back({
+      .key = key,
+      .nonce = nonce,
+      .associated_data = associated_data[i],
+      .plaintext = plaintexts[i],
+      .ciphertext = ciphertexts[i],
+      .tag = tags[i],
+    });
+    decrypt_packets.push_back({
+      .key = key,
+      .nonce = nonce,
+      .associated_data = associated_data[i],
+      .ciphertext = ciphertexts[i],
+      .plaintext = decrypteds[i],
+      .tag = tags[i],
+    });
+  }
+
+  ascon_instrumentation::reset();
+  EXPECT_EQ(ascon_aead128::encrypt_burst<LANES>(encrypt_packets), ascon_aead128::ascon_aead128_status_t::encrypted_burst);
+  EXPECT_EQ(ascon_aead128::decrypt_burst<LANES>(decrypt_packets, results), ascon_aead128::ascon_aead128_status_t::decrypted_burst);
+  const auto burst_snapshot = ascon_instrumentation::snapshot();
+
+  // Same packets, one at a time, using the scalar Ascon permutation.
+  ascon_instrumentation::reset();
+  for (size_t i = 0; i < ad_and_pt_byte_lens.size(); i++) {
+    std::vector<uint8_t> ciphertext_and_tag(plaintexts[i].size() + ascon_aead128::TAG_BYTE_LEN);
+
+    const ascon_aead128::ascon_aead128_key_t key_ctx(key);
+    EXPECT_EQ(ascon_aead128::seal(key_ctx, nonce, associated_data[i], plaintexts[i], ciphertext_and_tag), ascon_aead128::ascon_aead128_status_t::sealed);
+    EXPECT_EQ(ascon_aead128::open(key_ctx, nonce, associated_data[i], ciphertext_and_tag, decrypteds[i]),
+              ascon_aead128::ascon_aead128_status_t::decryption_success_as_tag_matches);
+  }
+  const auto one_at_a_time_snapshot = ascon_instrumentation::snapshot();
+
+  EXPECT_EQ(burst_snapshot.permutations, one_at_a_time_snapshot.permutations);
+  for (const auto phase : { phase_t::aead_associated_data, phase_t::aead_encrypt, phase_t::aead_decrypt }) {
+    EXPECT_EQ(burst_snapshot[phase].full_blocks, one_at_a_time_snapshot[phase].full_blocks);
+    EXPECT_EQ(burst_snapshot[phase].partial_blocks, one_at_a_time_snapshot[phase].partial_blocks);
+    EXPECT_EQ(burst_snapshot[phase].bytes, one_at_a_time_snapshot[phase].bytes);
+  }
+  EXPECT_GT(burst_snapshot[phase_t::aead_encrypt].bytes, 0u);
+}
+
+TEST(AsconInstrumentation, CountersAreThreadLocal)
+{
+  constexpr size_t NUM_THREADS = 4;
+  constexpr size_t MSG_BYTE_LEN = 64;
+
+  ascon_instrumentation::reset();
+
+  std::array<ascon_instrumentation::ascon_instrumentation_snapshot_t, NUM_THREADS> snapshots{};
+  std::vector<std::thread> threads;
+
+  for (size_t thread_idx = 0; thread_idx < NUM_THREADS; thread_idx++) {
+    threads.emplace_back([&snapshots, thread_idx]() {
+      std::array<uint8_t, MSG_BYTE_LEN> msg{};
+      std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+      // Each thread hashes a different number of messages, so that counts would mix up, if counters were shared.
+      for (size_t i = 0; i <= thread_idx; i++) {
+        ascon_hash256::hash<MSG_BYTE_LEN>(msg, digest);
+      }
+
+      snapshots[thread_idx] = ascon_instrumentation::snapshot();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(ascon_instrumentation::snapshot().total_permutations(), 0u);
+
+  ascon_instrumentation::ascon_instrumentation_snapshot_t aggregate{};
+  for (size_t thread_idx = 0; thread_idx < NUM_THREADS; thread_idx++) {
+    const size_t num_hashes = thread_idx + 1;
+
+    // Full blocks and padding are absorbed in unrolled sequence, while the digest is squeezed, without permuting after its last block.
+    const size_t num_perms_per_hash = (MSG_BYTE_LEN / HASH_RATE_BYTES) + 1 + (ascon_hash256::DIGEST_BYTE_LEN / HASH_RATE_BYTES - 1);
+    EXPECT_EQ(snapshots[thread_idx].permutations[ascon_sponge_mode::ASCON_PERM_NUM_ROUNDS], num_hashes * num_perms_per_hash);
+    EXPECT_EQ(snapshots[thread_idx][phase_t::hash_absorb].bytes, num_hashes * MSG_BYTE_LEN);
+
+    aggregate += snapshots[thread_idx];
+  }
+
+  const size_t total_num_hashes = (NUM_THREADS * (NUM_THREADS + 1)) / 2;
+  EXPECT_EQ(aggregate[phase_t::hash_absorb].full_blocks, total_num_hashes * (MSG_BYTE_LEN / HASH_RATE_BYTES));
+  EXPECT_EQ(aggregate[phase_t::hash_squeeze].bytes, total_num_hashes * ascon_hash256::DIGEST_BYTE_LEN);
+}
+
+#else
+
+TEST(AsconInstrumentation, NothingIsCountedWhenDisabled)
+{
+  std::array<uint8_t, 64> msg{};
+  std::array<uint8_t, ascon_hash256::DIGEST_BYTE_LEN> digest{};
+
+  generate_random_data<uint8_t>(msg);
+
+  ascon_hash256::ascon_hash256_t hasher;
+  EXPECT_EQ(hasher.absorb(msg), ascon_hash256::ascon_hash256_status_t::absorbed_data);
+  EXPECT_EQ(hasher.finalize(), ascon_hash256::ascon_hash256_status_t::finalized_data_absorption_phase);
+  EXPECT_EQ(hasher.digest(digest), ascon_hash256::ascon_hash256_status_t::message_digest_produced);
+
+  const auto snapshot = ascon_instrumentation::snapshot();
+
+  EXPECT_FALSE(ascon_instrumentation::is_enabled);
+  EXPECT_EQ(snapshot.total_permutations(), 0u);
+  for (const auto& phase : snapshot.phases) {
+    EXPECT_EQ(phase.full_blocks, 0u);
+    EXPECT_EQ(phase.partial_blocks, 0u);
+    EXPECT_EQ(phase.bytes, 0u);
+  }
+}
+
+#endif
@@ -0,0 +1,204 @@
+#include "ascon/hashes/ascon_hash256.hpp"
+#include "ascon/hashes/ascon_merkle_tree.hpp"
+#include "test_helper.hpp"
+#include <array>
+#include <gtest/gtest.h>
+#include <vector>
+
+// Computes Ascon-Hash256 digest of concatenation of given parts.
+static ascon_merkle_tree::digest_t
+hash256(std::span<const std::span<const uint8_t>> parts)
+{
+  ascon_merkle_tree::digest_t digest{};
+
+  ascon_hash256::ascon_hash256_t hasher;
+  for (const auto part : parts) {
+    EXPECT_EQ(hasher.absorb(part), ascon_hash256::ascon_hash256_status_t::absorbed_data);
+  }
+  EXPECT_EQ(hasher.finalize(), ascon_hash256::ascon_hash256_status_t::finalized_data_absorption_phase);
+  EXPECT_EQ(hasher.digest(digest), ascon_hash256::ascon_hash256_status_t::message_digest_produced);
+
+  return digest;
+}
+
+// Computes root hash of the Merkle tree over leaves, recursively, following definition of Merkle Tree Hash in section 2.1.1 of RFC 9162.
+static ascon_merkle_tree::digest_t
+reference_root(std::span<const std::vector<uint8_t>> leaves)
+{
+  constexpr std::array<uint8_t, 8> leaf_domain{ 0 };
+  constexpr std::array<uint8_t, 8> node_domain{ 1 };
+
+  if (leaves.size() == 1) {
+    const std::array<std::span<const uint8_t>, 2> parts{ leaf_domain, leaves.front() };
+    return hash256(parts);
+  }
+
+  size_t k = 1;
+  while ((k << 1) < leaves.size()) {
+    k <<= 1;
+  }
+
+  const auto left = reference_root(leaves.first(k));
+  const auto right = reference_root(leaves.subspan(k));
+
+  const std::array<std::span<const uint8_t>, 3> parts{ node_domain, left, right };
+  return hash256(parts);
+}
+
+// Generates given number of random leaves, of varying lengths.
+static std::vector<std::vector<uint8_t>>
+generate_leaves(const size_t num_leaves)
+{
+  std::vector<std::vector<uint8_t>> leaves(num_leaves);
+  for (size_t i = 0; i < num_leaves; i++) {
+    leaves[i].resize(i % 41);
+    generate_random_data<uint8_t>(leaves[i]);
+  }
+
+  return leaves;
+}
+
+template<const size_t LANES>
+static void
+test_built_tree_matches_reference(std::span<const std::vector<uint8_t>> leaves, std::span<const uint8_t> expected)
+{
+  const std::vector<std::span<const uint8_t>> leaf_spans(leaves.begin(), leaves.end());
+
+  for (const size_t num_threads : { 1, 3 }) {
+    ascon_parallel::thread_pool_t pool(num_threads);
+
+    ascon_merkle_tree::ascon_merkle_tree_t tree;
+    tree.build<LANES>(pool, leaf_spans);
+
+    ascon_merkle_tree::digest_t computed{};
+    EXPECT_EQ(tree.root(computed), ascon_merkle_tree::ascon_merkle_tree_status_t::computed_root);
+    EXPECT_TRUE(std::ranges::equal(computed, expected));
+  }
+}
+
+TEST(AsconMerkleTree, LeafAndNodeHashesAreDomainSeparatedAsconHash256)
+{
+  constexpr std::array<uint8_t, 8> leaf_domain{ 0 };
+  constexpr std::array<uint8_t, 8> node_domain{ 1 };
+
+  for (size_t leaf_len = 0; leaf_len <= 40; leaf_len++) {
+    std::vector<uint8_t> leaf(leaf_len);
+    generate_random_data<uint8_t>(leaf);
+
+    ascon_merkle_tree::digest_t computed{};
+    ascon_merkle_tree::hash_leaf(leaf, computed);
+
+    const std::array<std::span<const uint8_t>, 2> parts{ leaf_domain, leaf };
+    EXPECT_EQ(computed, hash256(parts));
+  }
+
+  ascon_merkle_tree::digest_t left{}, right{}, parent{};
+  generate_random_data<uint8_t>(left);
+  generate_random_data<uint8_t>(right);
+
+  ascon_merkle_tree::hash_node(left, right, parent);
+
+  const std::array<std::span<const uint8_t>, 3> parts{ node_domain, left, right };
+  EXPECT_EQ(parent, hash256(parts));
+}
+
+TEST(AsconMerkleTree, BuiltAndAppendedTreesMatchReferenceRoot)
+{
+  for (size_t num_leaves = 1; num_leaves <= 70; num_leaves++) {
+    const auto leaves = generate_leaves(num_leaves);
+    const auto expected = reference_root(leaves);
+
+    test_built_tree_matches_reference<1>(leaves, expected);
+    test_built_tree_matches_reference<4>(leaves, expected);
+    test_built_tree_matches_reference<8>(leaves, expected);
+
+    ascon_merkle_tree::ascon_merkle_tree_t tree;
+    for (const auto& leaf : leaves) {
+      tree.append(leaf);
+    }
+
+    ascon_merkle_tree::digest_t computed{};
+    EXPECT_EQ(tree.root(computed), ascon_merkle_tree::ascon_merkle_tree_status_t::computed_root);
+    EXPECT_EQ(computed, expected);
+    EXPECT_EQ(tree.leaf_count(), num_leaves);
+  }
+}
+
+TEST(AsconMerkleTree, AppendingToBuiltTreeMatchesBuildingWholeTree)
+{
+  const auto leaves = generate_leaves(1'000);
+  const std::vector<std::span<const uint8_t>> leaf_spans(leaves.begin(), leaves.end());
+
+  ascon_merkle_tree::ascon_merkle_tree_t whole;
+  whole.build(ascon_parallel::default_thread_pool(), leaf_spans);
+
+  ascon_merkle_tree::ascon_merkle_tree_t appended;
+  appended.build(ascon_parallel::default_thread_pool(), std::span(leaf_spans).first(333));
+  for (size_t i = 333; i < leaves.size(); i++) {
+    appended.append(leaves[i]);
+  }
+
+  ASSERT_EQ(whole.level_count(), appended.level_count());
+  for (size_t level = 0; level < whole.level_count(); level++) {
+    EXPECT_TRUE(std::ranges::equal(whole.nodes_at_level(level), appended.nodes_at_level(level)));
+  }
+}
+
+TEST(AsconMerkleTree, InclusionProofsOfAllLeavesVerify)
+{
+  for (size_t num_leaves = 1; num_leaves <= 40; num_leaves++) {
+    const auto leaves = generate_leaves(num_leaves);
+    const std::vector<std::span<const uint8_t>> leaf_spans(leaves.begin(), leaves.end());
+
+    ascon_merkle_tree::ascon_merkle_tree_t tree;
+    tree.build(ascon_parallel::default_thread_pool(), leaf_spans);
+
+    ascon_merkle_tree::digest_t root{};
+    EXPECT_EQ(tree.root(root), ascon_merkle_tree::ascon_merkle_tree_status_t::computed_root);
+
+    for (size_t leaf_idx = 0; leaf_idx < num_leaves; leaf_idx++) {
+      std::vector<ascon_merkle_tree::digest_t> proof;
+      EXPECT_EQ(tree.prove(leaf_idx, proof), ascon_merkle_tree::ascon_merkle_tree_status_t::generated_proof);
+
+      EXPECT_EQ(ascon_merkle_tree::verify(leaves[leaf_idx], leaf_idx, num_leaves, proof, root),
+                ascon_merkle_tree::ascon_merkle_tree_status_t::verified_proof);
+
+      // Same proof must not verify for any other position or leaf
+      if (num_leaves > 1) {
+        const size_t other_idx = (leaf_idx + 1) % num_leaves;
+        EXPECT_EQ(ascon_merkle_tree::verify(leaves[leaf_idx], other_idx, num_leaves, proof, root),
+                  ascon_merkle_tree::ascon_merkle_tree_status_t::failed_to_verify_proof);
+      }
+      std::vector<uint8_t> tampered_leaf = leaves[leaf_idx];
+      tampered_leaf.push_back(0xff);
+      EXPECT_EQ(ascon_merkle_tree::verify(tampered_leaf, leaf_idx, num_leaves, proof, root),
+                ascon_merkle_tree::ascon_merkle_tree_status_t::failed_to_verify_proof);
+
+      // Flipping a bit of any proof element must make it invalid
+      for (auto& p : proof) {
+        do_bitflip(p);
+        EXPECT_EQ(ascon_merkle_tree::verify(leaves[leaf_idx], leaf_idx, num_leaves, proof, root),
+                  ascon_merkle_tree::ascon_merkle_tree_status_t::failed_to_verify_proof);
+        do_bitflip(p);
+      }
+    }
+  }
+}
+
+TEST(AsconMerkleTree, EmptyTreeAndOutOfRangeLeafIndex)
+{
+  ascon_merkle_tree::ascon_merkle_tree_t tree;
+  ascon_merkle_tree::digest_t root{};
+  std::vector<ascon_merkle_tree::digest_t> proof;
+
+  EXPECT_EQ(tree.root(root), ascon_merkle_tree::ascon_merkle_tree_status_t::empty_tree);
+  EXPECT_EQ(tree.prove(0, proof), ascon_merkle_tree::ascon_merkle_tree_status_t::leaf_index_out_of_range);
+
+  std::array<uint8_t, 16> leaf{};
+  tree.append(leaf);
+
+  EXPECT_EQ(tree.root(root), ascon_merkle_tree::ascon_merkle_tree_status_t::computed_root);
+  EXPECT_EQ(tree.prove(0, proof), ascon_merkle_tree::ascon_merkle_tree_status_t::generated_proof);
+  EXPECT_EQ(tree.prove(1, proof), ascon_merkle_tree::ascon_merkle_tree_status_t::leaf_index_out_of_range);
+  EXPECT_EQ(ascon_merkle_tree::verify(leaf, 1, 1, proof, root), ascon_merkle_tree::ascon_merkle_tree_status_t::failed_to_verify_proof);
+}
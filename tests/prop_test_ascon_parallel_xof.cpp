@@ -0,0 +1,85 @@
+#include "ascon/hashes/ascon_cxof128.hpp"
+#include "ascon/hashes/ascon_parallel_xof.hpp"
+#include "test_helper.hpp"
+#include <array>
+#include <gtest/gtest.h>
+#include <vector>
+
+// Generates output of given length, one stream at a time, using Ascon-CXOF128 API - the way parallel XOF is specified.
+static std::vector<uint8_t>
+generate_one_stream_at_a_time(std::span<const uint8_t> seed, const size_t out_len)
+{
+  std::vector<uint8_t> out(out_len);
+  auto out_span = std::span(out);
+
+  for (size_t offset = 0, stream_idx = 0; offset < out_len; offset += ascon_parallel_xof::STREAM_BYTE_LEN, stream_idx++) {
+    std::array<uint8_t, sizeof(uint64_t)> cust_str{};
+    ascon_common_utils::to_le_bytes(static_cast<uint64_t>(stream_idx), cust_str);
+
+    ascon_cxof128::ascon_cxof128_t xof;
+    EXPECT_EQ(xof.customize(cust_str), ascon_cxof128::ascon_cxof128_status_t::customized);
+    EXPECT_EQ(xof.absorb(seed), ascon_cxof128::ascon_cxof128_status_t::absorbed_data);
+    EXPECT_EQ(xof.finalize(), ascon_cxof128::ascon_cxof128_status_t::finalized_data_absorption_phase);
+    EXPECT_EQ(xof.squeeze(out_span.subspan(offset, std::min(ascon_parallel_xof::STREAM_BYTE_LEN, out_len - offset))),
+              ascon_cxof128::ascon_cxof128_status_t::squeezed_output);
+  }
+
+  return out;
+}
+
+template<const size_t LANES>
+static void
+test_parallel_xof_matches_one_stream_at_a_time(std::span<const uint8_t> seed, const size_t out_len, const std::vector<uint8_t>& expected)
+{
+  for (const size_t num_threads : { 1, 3 }) {
+    ascon_parallel::thread_pool_t pool(num_threads);
+
+    std::vector<uint8_t> out(out_len);
+    ascon_parallel_xof::generate<LANES>(pool, seed, out);
+
+    EXPECT_EQ(out, expected);
+  }
+}
+
+TEST(AsconParallelXof, ForSameSeedParallelAndOneStreamAtATimeGenerationProducesSameOutput)
+{
+  constexpr size_t S = ascon_parallel_xof::STREAM_BYTE_LEN;
+  constexpr std::array<size_t, 11> OUT_LENS = { 0, 1, 7, 8, 9, S - 1, S, S + 1, 3 * S + 5, 8 * S, 37 * S + 3 };
+
+  for (const size_t seed_len : { 0, 1, 16, 32, 77 }) {
+    std::vector<uint8_t> seed(seed_len);
+    generate_random_data<uint8_t>(seed);
+
+    for (const size_t out_len : OUT_LENS) {
+      const auto expected = generate_one_stream_at_a_time(seed, out_len);
+
+      test_parallel_xof_matches_one_stream_at_a_time<1>(seed, out_len, expected);
+      test_parallel_xof_matches_one_stream_at_a_time<2>(seed, out_len, expected);
+      test_parallel_xof_matches_one_stream_at_a_time<4>(seed, out_len, expected);
+      test_parallel_xof_matches_one_stream_at_a_time<8>(seed, out_len, expected);
+    }
+  }
+}
+
+TEST(AsconParallelXof, ShorterOutputIsPrefixOfLongerOutput)
+{
+  std::array<uint8_t, 32> seed{};
+  generate_random_data<uint8_t>(seed);
+
+  std::vector<uint8_t> longer(5 * ascon_parallel_xof::STREAM_BYTE_LEN + 11);
+  ascon_parallel_xof::generate(ascon_parallel::default_thread_pool(), seed, longer);
+
+  for (const size_t out_len : { size_t(1), ascon_parallel_xof::STREAM_BYTE_LEN + 3, longer.size() - 1 }) {
+    std::vector<uint8_t> shorter(out_len);
+    ascon_parallel_xof::generate(ascon_parallel::default_thread_pool(), seed, shorter);
+
+    EXPECT_TRUE(std::ranges::equal(shorter, std::span(longer).first(out_len)));
+  }
+
+  // Flipping a single bit of the seed must change the output.
+  std::vector<uint8_t> other(longer.size());
+  do_bitflip(seed);
+  ascon_parallel_xof::generate(ascon_parallel::default_thread_pool(), seed, other);
+
+  EXPECT_NE(other, longer);
+}
@@ -0,0 +1,198 @@
+#include "ascon/permutation/ascon.hpp"
+#include "ascon/permutation/ascon_xN.hpp"
+#include "test_helper.hpp"
+#include <array>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <string>
+
+// Applies R -rounds permutation on N random states, both using multi-lane and scalar permutation, checking that each lane matches its scalar counterpart.
+template<const size_t R, const size_t N>
+static void
+test_multi_lane_permutation_matches_scalar()
+{
+  std::array<std::array<uint64_t, ascon_perm::PERMUTATION_STATE_WORD_COUNT>, N> lanes{};
+  for (auto& lane : lanes) {
+    generate_random_data<uint64_t>(lane);
+  }
+
+  ascon_perm::ascon_perm_xN_t<N> multi_lane_state;
+  for (size_t lane_idx = 0; lane_idx < N; lane_idx++) {
+    multi_lane_state.set_lane(lane_idx, ascon_perm::ascon_perm_t(lanes[lane_idx]));
+  }
+
+  multi_lane_state.template permute<R>();
+
+  for (size_t lane_idx = 0; lane_idx < N; lane_idx++) {
+    ascon_perm::ascon_perm_t scalar_state(lanes[lane_idx]);
+    scalar_state.permute<R>();
+
+    EXPECT_EQ(multi_lane_state.get_lane(lane_idx).reveal(), scalar_state.reveal());
+  }
+}
+
+template<const size_t N>
+static void
+test_multi_lane_permutation_matches_scalar_for_all_round_counts()
+{
+  test_multi_lane_permutation_matches_scalar<1, N>();
+  test_multi_lane_permutation_matches_scalar<6, N>();
+  test_multi_lane_permutation_matches_scalar<8, N>();
+  test_multi_lane_permutation_matches_scalar<12, N>();
+  test_multi_lane_permutation_matches_scalar<16, N>();
+}
+
+TEST(AsconPermutation, MultiLanePermutationMatchesScalarPermutation)
+{
+  for_each_supported_perm_backend([](const ascon_perm::ascon_perm_backend_t backend) {
+    SCOPED_TRACE(ascon_perm::backend_name(backend));
+
+    test_multi_lane_permutation_matches_scalar_for_all_round_counts<1>();
+    test_multi_lane_permutation_matches_scalar_for_all_round_counts<2>();
+    test_multi_lane_permutation_matches_scalar_for_all_round_counts<3>();
+    test_multi_lane_permutation_matches_scalar_for_all_round_counts<4>();
+    test_multi_lane_permutation_matches_scalar_for_all_round_counts<5>();
+    test_multi_lane_permutation_matches_scalar_for_all_round_counts<8>();
+    test_multi_lane_permutation_matches_scalar_for_all_round_counts<12>();
+    test_multi_lane_permutation_matches_scalar_for_all_round_counts<16>();
+  });
+}
+
+TEST(AsconPermutation, RunTimeBackendSelection)
+{
+  EXPECT_TRUE(ascon_perm::is_backend_supported(ascon_perm::ascon_perm_backend_t::portable));
+  EXPECT_TRUE(ascon_perm::is_backend_supported(ascon_perm::active_backend()));
+  EXPECT_TRUE(ascon_perm::is_backend_supported(ascon_perm::best_supported_backend()));
+
+  for_each_supported_perm_backend([](const ascon_perm::ascon_perm_backend_t backend) { EXPECT_EQ(ascon_perm::active_backend(), backend); });
+}
+
+TEST(AsconPermutation, UnknownBackendOverrideIsReported)
+{
+  const char* saved = std::getenv(ascon_perm::BACKEND_ENV_VAR);
+  const std::string saved_value = saved != nullptr ? saved : "";
+
+  ASSERT_EQ(::setenv(ascon_perm::BACKEND_ENV_VAR, "avx3", 1), 0);
+
+  testing::internal::CaptureStderr();
+  const auto backend = ascon_perm::initial_backend();
+  const std::string warning = testing::internal::GetCapturedStderr();
+
+  EXPECT_EQ(backend, ascon_perm::best_supported_backend());
+  EXPECT_NE(warning.find("ASCON_PERM_BACKEND=avx3"), std::string::npos);
+
+  ASSERT_EQ(::setenv(ascon_perm::BACKEND_ENV_VAR, "portable", 1), 0);
+
+  testing::internal::CaptureStderr();
+  EXPECT_EQ(ascon_perm::initial_backend(), ascon_perm::ascon_perm_backend_t::portable);
+  EXPECT_TRUE(testing::internal::GetCapturedStderr().empty());
+
+  if (saved != nullptr) {
+    ASSERT_EQ(::setenv(ascon_perm::BACKEND_ENV_VAR, saved_value.c_str(), 1), 0);
+  } else {
+    ASSERT_EQ(::unsetenv(ascon_perm::BACKEND_ENV_VAR), 0);
+  }
+}
+
+// Applies 12 -rounds permutation on 4 statically known states, both using multi-lane and scalar permutation, during program compilation time.
+constexpr bool
+eval_multi_lane_permutation()
+{
+  constexpr size_t N = 4;
+
+  ascon_perm::ascon_perm_xN_t<N> multi_lane_state;
+  for (size_t lane_idx = 0; lane_idx < N; lane_idx++) {
+    multi_lane_state.set_lane(lane_idx, ascon_perm::ascon_perm_t({ lane_idx, lane_idx + 1, lane_idx + 2, lane_idx + 3, lane_idx + 4 }));
+  }
+
+  multi_lane_state.permute<12>();
+
+  bool is_matching = true;
+  for (size_t lane_idx = 0; lane_idx < N; lane_idx++) {
+    ascon_perm::ascon_perm_t scalar_state({ lane_idx, lane_idx + 1, lane_idx + 2, lane_idx + 3, lane_idx + 4 });
+    scalar_state.permute<12>();
+
+    is_matching &= multi_lane_state.get_lane(lane_idx).reveal() == scalar_state.reveal();
+  }
+
+  return is_matching;
+}
+
+TEST(AsconPermutation, CompileTimeMultiLanePermutation)
+{
+  constexpr auto is_matching = eval_multi_lane_permutation();
+
+  static_assert(is_matching, "Must be able to apply multi-lane Ascon permutation during program compilation time itself !");
+  EXPECT_TRUE(is_matching);
+}
+
+// Applies R -rounds permutation on a random state, both using 64 -bit and bit-interleaved 32 -bit state representation, checking that they match.
+template<const size_t R>
+static void
+test_bit_interleaved_permutation_matches_u64()
+{
+  std::array<uint64_t, ascon_perm::PERMUTATION_STATE_WORD_COUNT> words{};
+  generate_random_data<uint64_t>(words);
+
+  ascon_perm::ascon_perm_u64_t u64_state(words);
+  ascon_perm::ascon_perm_bi32_t bi32_state(words);
+
+  EXPECT_EQ(bi32_state.reveal(), words);
+
+  u64_state.permute<R>();
+  bi32_state.permute<R>();
+
+  EXPECT_EQ(bi32_state.reveal(), u64_state.reveal());
+}
+
+TEST(AsconPermutation, BitInterleavedPermutationMatchesU64Permutation)
+{
+  for (size_t i = 0; i < 64; i++) {
+    std::array<uint64_t, 1> word{};
+    generate_random_data<uint64_t>(word);
+
+    EXPECT_EQ(ascon_perm::bit_deinterleave(ascon_perm::bit_interleave(word[0])), word[0]);
+    EXPECT_EQ(ascon_perm::bit_interleave(uint64_t{ 1 } << i), (i % 2 == 0) ? (uint64_t{ 1 } << (i / 2)) : (uint64_t{ 1 } << (32 + i / 2)));
+
+    test_bit_interleaved_permutation_matches_u64<1>();
+    test_bit_interleaved_permutation_matches_u64<6>();
+    test_bit_interleaved_permutation_matches_u64<8>();
+    test_bit_interleaved_permutation_matches_u64<12>();
+    test_bit_interleaved_permutation_matches_u64<16>();
+  }
+}
+
+#if defined(ASCON_PERM_HAS_AVX512_BACKEND)
+
+// Applies R -rounds permutation on a random state, both using single-state AVX-512 and bit-interleaved permutation, which doesn't share any code with it,
+// checking that both of them agree.
+template<const size_t R>
+static void
+test_single_state_avx512_permutation_matches_scalar()
+{
+  std::array<uint64_t, ascon_perm::PERMUTATION_STATE_WORD_COUNT> words{};
+  generate_random_data<uint64_t>(words);
+
+  ascon_perm::ascon_perm_bi32_t bi32_state(words);
+  bi32_state.permute<R>();
+
+  ascon_perm_avx512::permute_single<R>(words, ascon_perm::ASCON_PERMUTATION_ROUND_CONSTANTS);
+  EXPECT_EQ(words, bi32_state.reveal());
+}
+
+TEST(AsconPermutation, SingleStateAVX512PermutationMatchesScalarPermutation)
+{
+  if (!ascon_perm::is_backend_supported(ascon_perm::ascon_perm_backend_t::avx512)) {
+    GTEST_SKIP() << "CPU doesn't support AVX-512F";
+  }
+
+  for (size_t i = 0; i < 64; i++) {
+    test_single_state_avx512_permutation_matches_scalar<1>();
+    test_single_state_avx512_permutation_matches_scalar<6>();
+    test_single_state_avx512_permutation_matches_scalar<8>();
+    test_single_state_avx512_permutation_matches_scalar<12>();
+    test_single_state_avx512_permutation_matches_scalar<16>();
+  }
+}
+
+#endif
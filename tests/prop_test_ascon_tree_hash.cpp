@@ -0,0 +1,195 @@
+#include "ascon/hashes/ascon_cxof128.hpp"
+#include "ascon/hashes/ascon_tree_hash.hpp"
+#include "test_helper.hpp"
+#include <array>
+#include <cassert>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <string_view>
+
+using namespace std::literals;
+
+// Message lengths, around chunk boundaries and odd number of chunks, exercising different left-balanced tree shapes.
+static constexpr std::array<size_t, 14> MSG_LENS = {
+  0,
+  1,
+  ascon_tree_hash::CHUNK_BYTE_LEN - 1,
+  ascon_tree_hash::CHUNK_BYTE_LEN,
+  ascon_tree_hash::CHUNK_BYTE_LEN + 1,
+  2 * ascon_tree_hash::CHUNK_BYTE_LEN,
+  3 * ascon_tree_hash::CHUNK_BYTE_LEN + 5,
+  4 * ascon_tree_hash::CHUNK_BYTE_LEN,
+  5 * ascon_tree_hash::CHUNK_BYTE_LEN - 7,
+  7 * ascon_tree_hash::CHUNK_BYTE_LEN,
+  8 * ascon_tree_hash::CHUNK_BYTE_LEN + 1,
+  9 * ascon_tree_hash::CHUNK_BYTE_LEN,
+  17 * ascon_tree_hash::CHUNK_BYTE_LEN + 123,
+  33 * ascon_tree_hash::CHUNK_BYTE_LEN + 8,
+};
+
+// Computes Ascon-CXOF128 output, customized with `cust_str`, over concatenation of given messages.
+static std::vector<uint8_t>
+cxof128(std::string_view cust_str, std::span<const std::span<const uint8_t>> msgs, const size_t out_len)
+{
+  std::vector<uint8_t> out(out_len);
+  const auto cust_str_bytes = std::span(reinterpret_cast<const uint8_t*>(cust_str.data()), cust_str.size());
+
+  ascon_cxof128::ascon_cxof128_t hasher;
+  EXPECT_EQ(hasher.customize(cust_str_bytes), ascon_cxof128::ascon_cxof128_status_t::customized);
+  for (const auto msg : msgs) {
+    EXPECT_EQ(hasher.absorb(msg), ascon_cxof128::ascon_cxof128_status_t::absorbed_data);
+  }
+  EXPECT_EQ(hasher.finalize(), ascon_cxof128::ascon_cxof128_status_t::finalized_data_absorption_phase);
+  EXPECT_EQ(hasher.squeeze(out), ascon_cxof128::ascon_cxof128_status_t::squeezed_output);
+
+  return out;
+}
+
+// Computes 32 -bytes Ascon tree hash of a statically known message, during program compilation time.
+constexpr std::array<uint8_t, 32>
+eval_ascon_tree_hash()
+{
+  std::array<uint8_t, 32> msg{};
+  std::iota(msg.begin(), msg.end(), 0);
+
+  std::array<uint8_t, 32> out{};
+
+  ascon_tree_hash::ascon_tree_hash_t hasher;
+  assert(hasher.absorb(msg) == ascon_tree_hash::ascon_tree_hash_status_t::absorbed_data);
+  assert(hasher.finalize() == ascon_tree_hash::ascon_tree_hash_status_t::finalized_data_absorption_phase);
+  assert(hasher.squeeze(out) == ascon_tree_hash::ascon_tree_hash_status_t::squeezed_output);
+
+  return out;
+}
+
+TEST(AsconTreeHash, CompileTimeComputeTreeHashOutput)
+{
+  constexpr auto computed = eval_ascon_tree_hash();
+
+  std::array<uint8_t, 32> msg{};
+  std::iota(msg.begin(), msg.end(), 0);
+
+  ascon_parallel::thread_pool_t pool(1);
+
+  std::array<uint8_t, 32> expected{};
+  ascon_tree_hash::hash(pool, msg, expected);
+
+  EXPECT_EQ(computed, expected);
+}
+
+TEST(AsconTreeHash, TreeIsBuiltOnAsconCXOF128)
+{
+  constexpr size_t OUT_LEN = 48;
+  constexpr size_t CV_LEN = ascon_tree_hash::CHAINING_VALUE_BYTE_LEN;
+
+  std::vector<uint8_t> msg(3 * ascon_tree_hash::CHUNK_BYTE_LEN + 17);
+  generate_random_data<uint8_t>(msg);
+
+  const auto msg_span = std::span<const uint8_t>(msg);
+  const auto chunk = [&](const size_t idx) {
+    const size_t offset = idx * ascon_tree_hash::CHUNK_BYTE_LEN;
+    return msg_span.subspan(offset, std::min(ascon_tree_hash::CHUNK_BYTE_LEN, msg_span.size() - offset));
+  };
+  const auto leaf = [&](const size_t idx) {
+    const std::array<std::span<const uint8_t>, 1> parts{ chunk(idx) };
+    return cxof128("leaf"sv, parts, CV_LEN);
+  };
+  const auto node = [&](std::span<const uint8_t> left, std::span<const uint8_t> right) {
+    const std::array<std::span<const uint8_t>, 2> parts{ left, right };
+    return cxof128("node"sv, parts, CV_LEN);
+  };
+
+  // Four chunks make a perfect binary tree.
+  const auto root_cv = node(node(leaf(0), leaf(1)), node(leaf(2), leaf(3)));
+
+  std::array<uint8_t, 8> msg_len_as_bytes{};
+  ascon_common_utils::to_le_bytes(msg.size(), msg_len_as_bytes);
+
+  const std::array<std::span<const uint8_t>, 2> root_parts{ msg_len_as_bytes, root_cv };
+  const auto expected = cxof128("root"sv, root_parts, OUT_LEN);
+
+  ascon_parallel::thread_pool_t pool(2);
+
+  std::vector<uint8_t> computed(OUT_LEN);
+  ascon_tree_hash::hash(pool, msg, computed);
+
+  EXPECT_EQ(computed, expected);
+}
+
+TEST(AsconTreeHash, ForSameMessageOneshotHashingAndIncrementalHashingProducesSameOutput)
+{
+  constexpr size_t OUT_LEN = 64;
+
+  for (const size_t msg_len : MSG_LENS) {
+    std::vector<uint8_t> msg(msg_len);
+    generate_random_data<uint8_t>(msg);
+
+    // Incremental hashing, absorbing message in random sized pieces, squeezing output in two pieces.
+    std::vector<uint8_t> incremental_out(OUT_LEN);
+    {
+      auto msg_span = std::span<const uint8_t>(msg);
+      auto out_span = std::span(incremental_out);
+
+      ascon_tree_hash::ascon_tree_hash_t hasher;
+
+      size_t off = 0;
+      while (off < msg_span.size()) {
+        std::array<uint8_t, 2> piece_len_as_bytes{};
+        generate_random_data<uint8_t>(piece_len_as_bytes);
+
+        // Mostly small pieces, sometimes more than a few chunks long.
+        const size_t piece_len = (piece_len_as_bytes[0] & 0x0f) == 0 ? (piece_len_as_bytes[1] + 1) * 256 : piece_len_as_bytes[1] + 1;
+        const size_t to_be_absorbed_num_bytes = std::min(piece_len, msg_span.size() - off);
+
+        EXPECT_EQ(hasher.absorb(msg_span.subspan(off, to_be_absorbed_num_bytes)), ascon_tree_hash::ascon_tree_hash_status_t::absorbed_data);
+        off += to_be_absorbed_num_bytes;
+      }
+
+      EXPECT_EQ(hasher.finalize(), ascon_tree_hash::ascon_tree_hash_status_t::finalized_data_absorption_phase);
+      EXPECT_EQ(hasher.squeeze(out_span.first(OUT_LEN / 3)), ascon_tree_hash::ascon_tree_hash_status_t::squeezed_output);
+      EXPECT_EQ(hasher.squeeze(out_span.subspan(OUT_LEN / 3)), ascon_tree_hash::ascon_tree_hash_status_t::squeezed_output);
+    }
+
+    // Incremental hashing, absorbing whole message at once, exercising multi-lane hashing of whole chunks.
+    std::vector<uint8_t> single_absorb_out(OUT_LEN);
+    {
+      ascon_tree_hash::ascon_tree_hash_t hasher;
+
+      EXPECT_EQ(hasher.absorb(msg), ascon_tree_hash::ascon_tree_hash_status_t::absorbed_data);
+      EXPECT_EQ(hasher.finalize(), ascon_tree_hash::ascon_tree_hash_status_t::finalized_data_absorption_phase);
+      EXPECT_EQ(hasher.squeeze(single_absorb_out), ascon_tree_hash::ascon_tree_hash_status_t::squeezed_output);
+    }
+
+    EXPECT_EQ(incremental_out, single_absorb_out);
+
+    // One-shot hashing, using different number of threads and lanes.
+    for (const size_t num_threads : { 1, 2, 3, 4 }) {
+      ascon_parallel::thread_pool_t pool(num_threads);
+      std::vector<uint8_t> oneshot_out(OUT_LEN);
+
+      ascon_tree_hash::hash(pool, msg, oneshot_out);
+      EXPECT_EQ(incremental_out, oneshot_out);
+
+      ascon_tree_hash::hash<1>(pool, msg, oneshot_out);
+      EXPECT_EQ(incremental_out, oneshot_out);
+
+      ascon_tree_hash::hash<4>(pool, msg, oneshot_out);
+      EXPECT_EQ(incremental_out, oneshot_out);
+    }
+  }
+}
+
+TEST(AsconTreeHash, ValidHashingSequence)
+{
+  std::array<uint8_t, 16> msg{};
+  std::array<uint8_t, 16> out{};
+
+  ascon_tree_hash::ascon_tree_hash_t hasher;
+
+  EXPECT_EQ(hasher.squeeze(out), ascon_tree_hash::ascon_tree_hash_status_t::still_in_data_absorption_phase);
+  EXPECT_EQ(hasher.absorb(msg), ascon_tree_hash::ascon_tree_hash_status_t::absorbed_data);
+  EXPECT_EQ(hasher.finalize(), ascon_tree_hash::ascon_tree_hash_status_t::finalized_data_absorption_phase);
+  EXPECT_EQ(hasher.absorb(msg), ascon_tree_hash::ascon_tree_hash_status_t::data_absorption_phase_already_finalized);
+  EXPECT_EQ(hasher.finalize(), ascon_tree_hash::ascon_tree_hash_status_t::data_absorption_phase_already_finalized);
+  EXPECT_EQ(hasher.squeeze(out), ascon_tree_hash::ascon_tree_hash_status_t::squeezed_output);
+}
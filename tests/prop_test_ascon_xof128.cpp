@@ -199,3 +199,56 @@ TEST(AsconXof128, SqueezeWithoutFinalize)
   EXPECT_EQ(xof.absorb(msg), ascon_xof128::ascon_xof128_status_t::absorbed_data);
   EXPECT_EQ(xof.squeeze(output), ascon_xof128::ascon_xof128_status_t::still_in_data_absorption_phase);
 }
+
+// Computes Ascon-XOF128 output of OUT_BYTE_LEN -bytes, over a random message of MSG_BYTE_LEN -bytes, both using compile-time specialized and incremental
+// API, checking that outputs match.
+template<const size_t MSG_BYTE_LEN, const size_t OUT_BYTE_LEN>
+static void
+test_fixed_length_xof_matches_incremental_xof()
+{
+  std::array<uint8_t, MSG_BYTE_LEN> msg{};
+  std::array<uint8_t, OUT_BYTE_LEN> out_fixed{};
+  std::array<uint8_t, OUT_BYTE_LEN> out_incremental{};
+
+  generate_random_data<uint8_t>(msg);
+
+  ascon_xof128::xof(std::span<const uint8_t, MSG_BYTE_LEN>(msg), std::span(out_fixed));
+
+  ascon_xof128::ascon_xof128_t xof;
+  EXPECT_EQ(xof.absorb(msg), ascon_xof128::ascon_xof128_status_t::absorbed_data);
+  EXPECT_EQ(xof.finalize(), ascon_xof128::ascon_xof128_status_t::finalized_data_absorption_phase);
+  EXPECT_EQ(xof.squeeze(out_incremental), ascon_xof128::ascon_xof128_status_t::squeezed_output);
+
+  EXPECT_EQ(out_fixed, out_incremental);
+}
+
+TEST(AsconXof128, ForSameMessageFixedLengthXofAndIncrementalXofProducesSameOutput)
+{
+  constexpr size_t NUM_LENGTHS = ascon_sponge_mode::RATE_BYTES * 2 + 1;
+
+  // Varying message length, for fixed output length, and vice versa
+  [&]<size_t... I>(std::index_sequence<I...>) {
+    (test_fixed_length_xof_matches_incremental_xof<I, 32>(), ...);
+    (test_fixed_length_xof_matches_incremental_xof<32, I>(), ...);
+  }(std::make_index_sequence<NUM_LENGTHS>{});
+
+  test_fixed_length_xof_matches_incremental_xof<64, 64>();
+  test_fixed_length_xof_matches_incremental_xof<128, 512>();
+}
+
+TEST(AsconXof128, CompileTimeComputeFixedLengthXofOutput)
+{
+  constexpr auto out = []() {
+    std::array<uint8_t, 32> data{};
+    std::iota(data.begin(), data.end(), 0);
+
+    std::array<uint8_t, 32> out{};
+    ascon_xof128::xof(std::span<const uint8_t, data.size()>(data), std::span(out));
+
+    return bytes_to_hex(out);
+  }();
+  constexpr auto is_matching = out == eval_ascon_xof128();
+
+  static_assert(is_matching, "Must be able to evaluate fixed-length Ascon-XOF128 during program compilation time itself !");
+  EXPECT_TRUE(is_matching);
+}
@@ -18,7 +18,7 @@ TEST_SOURCES := $(wildcard $(TEST_DIR)/*.cpp)
 TEST_HEADERS := $(wildcard $(TEST_DIR)/*.hpp)
 TEST_OBJECTS := $(addprefix $(TEST_BUILD_DIR)/, $(notdir $(TEST_SOURCES:.cpp=.o)))
 TEST_BINARY := $(TEST_BUILD_DIR)/test.out
-TEST_LINK_FLAGS := -lgtest -lgtest_main
+TEST_LINK_FLAGS := -lgtest -lgtest_main -lpthread
 GTEST_PARALLEL := ./gtest-parallel/gtest-parallel
 
 DEBUG_ASAN_TEST_OBJECTS := $(addprefix $(DEBUG_ASAN_BUILD_DIR)/, $(notdir $(TEST_SOURCES:.cpp=.o)))
@@ -1,11 +1,15 @@
 #pragma once
+#include "ascon/permutation/dispatch.hpp"
 #include <array>
 #include <cassert>
 #include <charconv>
 #include <cstddef>
 #include <cstdint>
+#include <gtest/gtest.h>
 #include <random>
 #include <span>
+#include <string>
+#include <unistd.h>
 
 static constexpr size_t MIN_AD_LEN = 0;
 static constexpr size_t MAX_AD_LEN = 64;
@@ -105,3 +109,51 @@ hex_to_bytes(std::string_view hex)
 
   return res;
 }
+
+// Writes given bytes to a fresh temporary file, returning its path. Test is failed, if the file can't be fully written.
+inline std::string
+write_temp_file(std::span<const uint8_t> bytes)
+{
+  std::string path = "/tmp/ascon_test_XXXXXX";
+
+  const int fd = ::mkstemp(path.data());
+  if (fd < 0) {
+    ADD_FAILURE() << "failed to create temporary file";
+    return path;
+  }
+
+  size_t off = 0;
+  while (off < bytes.size()) {
+    const ssize_t n = ::write(fd, bytes.data() + off, bytes.size() - off);
+    if (n <= 0) {
+      ADD_FAILURE() << "failed to write " << path;
+      break;
+    }
+
+    off += static_cast<size_t>(n);
+  }
+
+  ::close(fd);
+  return path;
+}
+
+// Invokes `fn(backend)`, once for each multi-lane permutation backend supported by the executing CPU, after switching to it. Initially selected backend
+// is restored at the end.
+template<typename F>
+static void
+for_each_supported_perm_backend(F&& fn)
+{
+  const auto initial = ascon_perm::active_backend();
+
+  for (const auto backend : { ascon_perm::ascon_perm_backend_t::portable,
+                              ascon_perm::ascon_perm_backend_t::avx2,
+                              ascon_perm::ascon_perm_backend_t::avx512,
+                              ascon_perm::ascon_perm_backend_t::neon,
+                              ascon_perm::ascon_perm_backend_t::sve }) {
+    if (ascon_perm::set_active_backend(backend)) {
+      fn(backend);
+    }
+  }
+
+  (void)ascon_perm::set_active_backend(initial);
+}